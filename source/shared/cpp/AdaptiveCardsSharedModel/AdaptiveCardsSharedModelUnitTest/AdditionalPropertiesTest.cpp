@@ -3,6 +3,8 @@
 #include "stdafx.h"
 #include "ParseUtil.h"
 #include "TextRun.h"
+#include "TextBlock.h"
+#include "Image.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
@@ -11,6 +13,18 @@ using namespace std::string_literals;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
+    // A host's TextBlock that understands a property of its own
+    class HostTextBlock : public TextBlock
+    {
+    public:
+        HostTextBlock()
+        {
+            static const std::unordered_set<std::string> knownProperties =
+                ParseUtil::ExtendKnownProperties(GetKnownProperties(), {"hostProperty"});
+            SetKnownProperties(knownProperties);
+        }
+    };
+
     TEST_CLASS(AdditionalPropertyTest)
     {
     public:
@@ -209,5 +223,79 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("{\"actions\":[],\"body\":[{\"text\":\"Standard textblock\",\"type\":\"TextBlock\"},{\"property\":\"value\",\"someOtherProperty\":\"some other value\",\"type\":\"SomeRandomType\"}],\"type\":\"AdaptiveCard\",\"version\":\"1.0\"}\n"s,
                 outputCard);
         }
+
+        TEST_METHOD(KnownPropertiesAreSharedPerTypeTest)
+        {
+            const TextBlock first;
+            const TextBlock second;
+            const Image image;
+
+            // one set per type, not per instance
+            Assert::IsTrue(&first.GetKnownProperties() == &second.GetKnownProperties());
+            Assert::IsTrue(&first.GetKnownProperties() != &image.GetKnownProperties());
+
+            // each type's set includes its base types' properties
+            const auto& textBlockProperties = first.GetKnownProperties();
+            Assert::IsTrue(textBlockProperties.count("type") == 1);
+            Assert::IsTrue(textBlockProperties.count("separator") == 1);
+            Assert::IsTrue(textBlockProperties.count("text") == 1);
+            Assert::IsTrue(textBlockProperties.count("wrap") == 1);
+            Assert::IsTrue(textBlockProperties.count("url") == 0);
+            Assert::IsTrue(image.GetKnownProperties().count("url") == 1);
+
+            const TextRun textRun;
+            Assert::IsTrue(textRun.GetKnownProperties().count("italic") == 1);
+        }
+
+        TEST_METHOD(KnownPropertiesCanBeExtendedTest)
+        {
+            const HostTextBlock hostTextBlock;
+            const TextBlock textBlock;
+
+            const auto& hostProperties = hostTextBlock.GetKnownProperties();
+            Assert::IsTrue(hostProperties.count("hostProperty") == 1);
+            Assert::IsTrue(hostProperties.count("text") == 1);
+            Assert::IsTrue(textBlock.GetKnownProperties().count("hostProperty") == 0);
+        }
+
+        TEST_METHOD(SkipAdditionalPropertiesTest)
+        {
+            const std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "unknown": "card",
+                "body": [
+                    {
+                        "type": "TextBlock",
+                        "text": "text",
+                        "unknown": "element",
+                        "inlines": []
+                    },
+                    {
+                        "type": "SomeRandomType",
+                        "property": "value"
+                    }
+                ],
+                "actions": [
+                    {
+                        "type": "Action.Submit",
+                        "unknown": "action"
+                    }
+                ]
+            })";
+
+            ParseContext context;
+            Assert::IsTrue(context.GetCaptureAdditionalProperties());
+            context.SetCaptureAdditionalProperties(false);
+
+            const auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.0", context)->GetAdaptiveCard();
+            Assert::IsTrue(card->GetAdditionalProperties().isNull());
+            Assert::IsTrue(card->GetBody().front()->GetAdditionalProperties().isNull());
+            Assert::IsTrue(card->GetActions().front()->GetAdditionalProperties().isNull());
+
+            // unknown elements are still kept whole
+            Assert::AreEqual("{\"actions\":[{\"type\":\"Action.Submit\"}],\"body\":[{\"text\":\"text\",\"type\":\"TextBlock\"},{\"property\":\"value\",\"type\":\"SomeRandomType\"}],\"type\":\"AdaptiveCard\",\"version\":\"1.0\"}\n"s,
+                             card->Serialize());
+        }
     };
 }
@@ -307,6 +307,22 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{a{DATE(2017-02-13T20:46:30Z, SHORT)}}", blck.GetText());
         }
+        TEST_METHOD(ExtraCurlyBracketsTest)
+        {
+            TextBlock blck;
+            std::string testString = "{{{{DATE(2017-02-13T20:46:30Z, SHORT)}}}";
+            blck.SetText(testString);
+
+            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            auto tokens = preparser.GetTextTokens();
+            Assert::AreEqual<size_t>(3, tokens.size());
+            Assert::AreEqual<std::string>(tokens[0]->GetText(), "{{");
+            Assert::IsTrue(tokens[0]->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
+            Assert::AreEqual<std::string>(tokens[1]->GetText(), "{{DATE(2017-02-13T20:46:30Z, SHORT)}}");
+            Assert::IsTrue(tokens[1]->GetFormat() == DateTimePreparsedTokenFormat::DateShort);
+            Assert::AreEqual<std::string>(tokens[2]->GetText(), "}");
+            Assert::IsTrue(tokens[2]->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
+        }
         TEST_METHOD(MissingClosingCurlyBracketTest)
         {
             TextBlock blck;
@@ -424,5 +440,26 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(1994-02-29T06:08:00Z)}}", blck.GetText());
         }
+        TEST_METHOD(CachedPreparseTest)
+        {
+            TextBlock blck;
+            blck.SetText("Due {{DATE(2017-02-13T20:46:30Z, COMPACT)}} at noon");
+
+            const DateTimePreparser& preparser = blck.GetTextForDateParsing();
+            Assert::IsTrue(&preparser == &blck.GetTextForDateParsing());
+            const std::vector<DateTimePreparsedToken>& tokens = preparser.GetTokens();
+            Assert::AreEqual<size_t>(3, tokens.size());
+            Assert::AreEqual<std::string>("Due ", tokens[0].GetText());
+            Assert::IsTrue(tokens[1].GetFormat() == DateTimePreparsedTokenFormat::DateCompact);
+            Assert::AreEqual<std::string>(" at noon", tokens[2].GetText());
+            Assert::AreEqual<size_t>(tokens.size(), preparser.GetTextTokens().size());
+            Assert::AreEqual<std::string>(tokens[1].GetText(), preparser.GetTextTokens()[1]->GetText());
+
+            // setting the text replaces the cached tokens
+            blck.SetText("No dates here");
+            Assert::AreEqual<size_t>(1, blck.GetTextForDateParsing().GetTokens().size());
+            Assert::AreEqual<std::string>("No dates here", blck.GetTextForDateParsing().GetTokens().front().GetText());
+            Assert::IsTrue(blck.GetTextForDateParsing().GetTokens().front().GetFormat() == DateTimePreparsedTokenFormat::RegularString);
+        }
     };
 }
@@ -12,6 +12,8 @@ using namespace std::string_literals;
 #define ENUM_TO_FROM_STRING_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
         Assert::AreEqual(ENUMNAME##ToString(VALIDVALUE), VALIDSTRING); \
         Assert::IsTrue(ENUMNAME##FromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsTrue(ENUMNAME##TryFromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsFalse(ENUMNAME##TryFromString("This is invalid.").has_value()); \
 
 #define ENUM_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
     ENUM_TEST_START(ENUMNAME)                                           \
@@ -29,6 +31,7 @@ using namespace std::string_literals;
         for (const auto& key : reverseMap)                              \
         {                                                               \
             Assert::IsTrue(ENUMNAME##FromString(key.first) == key.second); \
+            Assert::IsTrue(ENUMNAME##TryFromString(key.first) == key.second); \
         }                                                               \
     }                                                                   \
 
@@ -58,5 +61,71 @@ namespace AdaptiveCardsSharedModelUnitTest
         ENUM_TEST_WITH_REVERSE_MAP(TextSize, TextSize::Large, "Large"s, {{"Normal", TextSize::Default}});
         ENUM_TEST_WITH_REVERSE_MAP(TextWeight, TextWeight::Bolder, "Bolder"s, {{"Normal", TextWeight::Default}});
         ENUM_TEST(VerticalContentAlignment, VerticalContentAlignment::Center, "Center"s);
+
+        TEST_METHOD(EnumLookupIsCaseInsensitiveTest)
+        {
+            Assert::IsTrue(CardElementTypeTryFromString("textblock") == CardElementType::TextBlock);
+            Assert::IsTrue(CardElementTypeTryFromString("INPUT.TEXT") == CardElementType::TextInput);
+            Assert::IsTrue(TextSizeTryFromString("NORMAL") == TextSize::Default);
+            Assert::IsTrue(ImageStyleFromString("Normal") == ImageStyle::Default);
+            Assert::IsFalse(CardElementTypeTryFromString("TextBlocks").has_value());
+            Assert::IsFalse(CardElementTypeTryFromString("").has_value());
+        }
+
+        TEST_METHOD(SchemaKeyStringViewTest)
+        {
+            for (int i = 0; i <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); ++i)
+            {
+                const auto key = static_cast<AdaptiveCardSchemaKey>(i);
+                const auto keyView = AdaptiveCardSchemaKeyToStringView(key);
+                if (keyView.empty())
+                {
+                    Assert::ExpectException<std::out_of_range>([key]() { AdaptiveCardSchemaKeyToString(key); });
+                }
+                else
+                {
+                    Assert::AreEqual(AdaptiveCardSchemaKeyToString(key), std::string{keyView});
+                }
+            }
+        }
+
+        TEST_METHOD(CaseInsensitiveHashTest)
+        {
+            const CaseInsensitiveHash hash{};
+            const CaseInsensitiveEqualTo equalTo{};
+
+            Assert::IsTrue(equalTo("TextBlock"s, "tEXTbLOCK"s));
+            Assert::IsFalse(equalTo("TextBlock"s, "TextBlocks"s));
+            Assert::AreEqual(hash("TextBlock"s), hash("TEXTBLOCK"s));
+
+            // the previous additive hash put anagrams in the same bucket
+            Assert::AreNotEqual(hash("Image"s), hash("Giema"s));
+            Assert::AreNotEqual(hash("Column"s), hash("Colmun"s));
+
+            // no two distinct schema keys should share a hash value
+            std::vector<std::string> schemaKeys;
+            for (int i = 0; i <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); ++i)
+            {
+                try
+                {
+                    schemaKeys.push_back(AdaptiveCardSchemaKeyToString(static_cast<AdaptiveCardSchemaKey>(i)));
+                }
+                catch (const std::out_of_range&)
+                {
+                    // not every key has a string form
+                }
+            }
+
+            for (size_t i = 0; i < schemaKeys.size(); ++i)
+            {
+                for (size_t j = i + 1; j < schemaKeys.size(); ++j)
+                {
+                    if (!equalTo(schemaKeys[i], schemaKeys[j]))
+                    {
+                        Assert::AreNotEqual(hash(schemaKeys[i]), hash(schemaKeys[j]));
+                    }
+                }
+            }
+        }
     };
 }
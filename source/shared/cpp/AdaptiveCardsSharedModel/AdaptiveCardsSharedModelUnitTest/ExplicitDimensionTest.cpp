@@ -595,5 +595,44 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<std::string>("20.5px", column->GetWidth());
             Assert::AreEqual<bool>(column->GetPixelWidth() == 20, true);
         }
+
+        TEST_METHOD(ExplicitWidthOutOfRangeTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"$schema\":\"http://adaptivecards.io/schemas/adaptive-card.json\",\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"body\": [\
+                    {\
+                        \"type\":\"ColumnSet\",\
+                        \"columns\": [\
+                            {\
+                                \"type\": \"Column\",\
+                                \"width\": \"2147483647px\",\
+                                \"items\": [\
+                                ]\
+                            },\
+                            {\
+                                \"type\": \"Column\",\
+                                \"width\": \"2147483648.5px\",\
+                                \"items\": [\
+                                ]\
+                            }\
+                        ]\
+                    }\
+                ]\
+            }";
+
+            std::shared_ptr<ParseResult> parseResult = AdaptiveCard::DeserializeFromString(testJsonString, "1.0");
+            Assert::AreEqual<size_t>(1, parseResult->GetWarnings().size());
+            Assert::AreEqual<bool>(true, parseResult->GetWarnings().at(0)->GetStatusCode() ==
+                WarningStatusCode::InvalidDimensionSpecified);
+            Assert::AreEqual<std::string>("out of range: 2147483648.5px", parseResult->GetWarnings().at(0)->GetReason());
+            std::shared_ptr<BaseCardElement> element = parseResult->GetAdaptiveCard()->GetBody().front();
+            std::shared_ptr<ColumnSet> columnSet = std::static_pointer_cast<ColumnSet>(element);
+            Assert::AreEqual<int>(2147483647, columnSet->GetColumns().at(0)->GetPixelWidth());
+            Assert::AreEqual<int>(0, columnSet->GetColumns().at(1)->GetPixelWidth());
+        }
     };
 }
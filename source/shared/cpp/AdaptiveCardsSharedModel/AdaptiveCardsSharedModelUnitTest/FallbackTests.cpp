@@ -522,6 +522,58 @@ namespace AdaptiveCardsSharedModelUnitTest
             AdaptiveCard::DeserializeFromString(cardStr, "1.2");
         }
 
+        TEST_METHOD(DuplicateIdWithFallbackChildren)
+        {
+            // the second "duplicate" owns fallback content with other ids; those entries must not hide the collision
+            std::string cardStr = R"card({
+              "type": "AdaptiveCard",
+              "$schema": "http://adaptivecards.io/schemas/adaptive-card.json",
+              "version": "1.2",
+              "body": [
+                {
+                  "type": "TextBlock",
+                  "id": "duplicate",
+                  "text": "First textblock"
+                },
+                {
+                  "type": "Container",
+                  "id": "duplicate",
+                  "items": [
+                    {
+                      "type": "TextBlock",
+                      "text": "Non-fallback textblock"
+                    }
+                  ],
+                  "fallback": {
+                    "type": "Container",
+                    "items": [
+                      {
+                        "type": "TextBlock",
+                        "id": "A",
+                        "text": "Fallback textblock A"
+                      },
+                      {
+                        "type": "TextBlock",
+                        "id": "B",
+                        "text": "Fallback textblock B"
+                      }
+                    ]
+                  }
+                }
+              ]
+            })card";
+            try
+            {
+                AdaptiveCard::DeserializeFromString(cardStr, "1.2");
+                Assert::IsTrue(false, L"Deserializing should throw an exception");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::IdCollision == e.GetStatusCode(), L"ErrorStatusCode incorrect");
+                Assert::AreEqual("Collision detected for id 'duplicate'", e.GetReason().c_str(), L"GetReason incorrect");
+            }
+        }
+
         TEST_METHOD(RequiresAndFallbackSerialization)
         {
             std::string cardStr = R"card({
@@ -595,6 +647,20 @@ namespace AdaptiveCardsSharedModelUnitTest
             featureRegistration.AddFeature("foobar", "99");
             Assert::IsTrue(textBlock->MeetsRequirements(featureRegistration));
             Assert::IsTrue(textBlockNoRequires->MeetsRequirements(featureRegistration));
+
+            // "*" provides any version
+            featureRegistration.RemoveFeature("foobar");
+            featureRegistration.AddFeature("FooBar", "*");
+            Assert::IsTrue(textBlock->MeetsRequirements(featureRegistration));
+            Assert::IsTrue(featureRegistration.SupportsFeatureVersion("foobar", SemanticVersion("99.1")));
+            Assert::IsTrue(featureRegistration.SupportsFeatureVersion("adaptiveCards", SemanticVersion("1.2")));
+            Assert::IsFalse(featureRegistration.SupportsFeatureVersion("adaptiveCards", SemanticVersion("99")));
+            Assert::IsFalse(featureRegistration.SupportsFeatureVersion("missing", SemanticVersion("0")));
+
+            // feature names are looked up without regard to case
+            Assert::AreEqual<std::string>("*", featureRegistration.GetFeatureVersion("FOOBAR"));
+            Assert::AreEqual<std::string>(c_sharedModelVersion, featureRegistration.GetFeatureVersion("ADAPTIVECARDS"));
+            Assert::AreEqual<std::string>("", featureRegistration.GetFeatureVersion("missing"));
         }
 
         TEST_METHOD(NestedFallbacksSerialization)
@@ -67,5 +67,60 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(expectedConfig.fontType == actualConfig.fontType);
         }
 
+        TEST_METHOD(CompiledHostConfigTest)
+        {
+            const std::string hostConfigJson = R"({
+                "fontFamily": "Deprecated Family",
+                "fontSizes": {
+                    "large": 30
+                },
+                "fontTypes": {
+                    "monospace": {
+                        "fontFamily": "Courier New",
+                        "fontWeights": {
+                            "bolder": 900
+                        }
+                    }
+                },
+                "containerStyles": {
+                    "emphasis": {
+                        "backgroundColor": "#F0F0F0",
+                        "foregroundColors": {
+                            "accent": {
+                                "default": "#800000FF",
+                                "subtle": "not a color"
+                            }
+                        }
+                    }
+                }
+            })";
+
+            auto hostConfig = HostConfig::DeserializeFromString(hostConfigJson);
+            const auto& compiled = hostConfig.GetCompiled();
+
+            Assert::AreEqual<std::string>("Deprecated Family", compiled.GetFontFamily(FontType::Default));
+            Assert::AreEqual<std::string>("Courier New", compiled.GetFontFamily(FontType::Monospace));
+            Assert::AreEqual(30u, compiled.GetFontSize(FontType::Monospace, TextSize::Large));
+            Assert::AreEqual(hostConfig.GetFontSize(FontType::Default, TextSize::Small), compiled.GetFontSize(FontType::Default, TextSize::Small));
+            Assert::AreEqual(900u, compiled.GetFontWeight(FontType::Monospace, TextWeight::Bolder));
+            Assert::AreEqual(hostConfig.GetFontWeight(FontType::Default, TextWeight::Bolder), compiled.GetFontWeight(FontType::Default, TextWeight::Bolder));
+
+            Assert::AreEqual(0xFFF0F0F0u, compiled.GetBackgroundColor(ContainerStyle::Emphasis));
+            Assert::AreEqual(0x800000FFu, compiled.GetForegroundColor(ContainerStyle::Emphasis, ForegroundColor::Accent, false));
+            Assert::AreEqual(0u, compiled.GetForegroundColor(ContainerStyle::Emphasis, ForegroundColor::Accent, true));
+
+            const auto& emphasis = hostConfig.GetContainerStyles().emphasisPalette;
+            Assert::AreEqual(0xFFF0F0F0u, emphasis.GetBackgroundColorArgb());
+            Assert::AreEqual(0x800000FFu, emphasis.foregroundColors.accent.GetDefaultColorArgb());
+            Assert::AreEqual(0u, emphasis.foregroundColors.accent.GetSubtleColorArgb());
+            Assert::AreEqual(0xFFFFFF00u, emphasis.foregroundColors.accent.highlightColors.GetDefaultColorArgb());
+            Assert::AreEqual(compiled.GetBackgroundColor(ContainerStyle::Default), compiled.GetBackgroundColor(ContainerStyle::None));
+
+            // setters keep the compiled lookups current
+            auto fontTypes = hostConfig.GetFontTypes();
+            fontTypes.defaultFontType.fontFamily = "Segoe UI";
+            hostConfig.SetFontTypes(fontTypes);
+            Assert::AreEqual<std::string>("Segoe UI", hostConfig.GetCompiled().GetFontFamily(FontType::Default));
+        }
     };
 }
@@ -31,6 +31,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string(""), backgroundColor);
+            Assert::IsFalse(image->GetBackgroundColorArgb().has_value());
         }
         TEST_METHOD(AARRGGBBTest)
         {
@@ -52,6 +53,8 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#ABF65314"), backgroundColor);
+            Assert::AreEqual(0xABF65314u, image->GetBackgroundColorArgb().value());
+            Assert::AreEqual(std::string("#ABF65314"), image->SerializeToJsonValue()["backgroundColor"].asString());
         }
 
         TEST_METHOD(RRGGBBTest)
@@ -74,6 +77,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#FF00A1F1"), backgroundColor);
+            Assert::AreEqual(0xFF00A1F1u, image->GetBackgroundColorArgb().value());
         }
 
         TEST_METHOD(LowerCaseCharactersTest)
@@ -96,6 +100,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#ffa65314"), backgroundColor);
+            Assert::AreEqual(0xFFA65314u, image->GetBackgroundColorArgb().value());
         }
 
         TEST_METHOD(InvalidLengthTest)
@@ -118,6 +123,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
+            Assert::AreEqual(0u, image->GetBackgroundColorArgb().value());
         }
 
         TEST_METHOD(InvalidCharacterTest)
@@ -140,6 +146,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
+            Assert::AreEqual(0u, image->GetBackgroundColorArgb().value());
         }
 
         TEST_METHOD(InvalidFormatTest)
@@ -162,6 +169,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
+            Assert::AreEqual(0u, image->GetBackgroundColorArgb().value());
         }
 
     };
@@ -760,5 +760,158 @@ namespace AdaptiveCardsSharedModelUnitTest
             (void) parser3.TransformToHtml();
             Assert::AreEqual<bool>(true, parser3.IsEscaped());
         }
+
+        TEST_METHOD(LinkTest_MissingDestinationAtEndOfTextTest)
+        {
+            MarkDownParser parser("[a](");
+            Assert::AreEqual<std::string>("<p>[a](</p>", parser.TransformToHtml());
+
+            MarkDownParser parser1("see [the docs](");
+            Assert::AreEqual<std::string>("<p>see [the docs](</p>", parser1.TransformToHtml());
+        }
+
+        TEST_METHOD(EmphasisTest_UnmatchedRightEmphasisTerminatesTest)
+        {
+            MarkDownParser parser("\\_1+!x6**6)*");
+            Assert::AreEqual<std::string>("<p>\\_1+!x6**6)*</p>", parser.TransformToHtml());
+
+            MarkDownParser parser1("- first item***really***");
+            Assert::AreEqual<std::string>("<ul><li>first item***really***</li></ul>", parser1.TransformToHtml());
+        }
+
+        TEST_METHOD(RunsTest_EmphasisAndLinkTest)
+        {
+            const std::string text = "a **b** [c _d_](https://e.com)";
+            MarkDownParser parser(text);
+            const auto runs = parser.TransformToRuns();
+            Assert::AreEqual<bool>(true, parser.HasHtmlTags());
+            Assert::AreEqual<size_t>(5, runs.size());
+
+            Assert::AreEqual<std::string>("a ", text.substr(runs[0].textOffset, runs[0].textLength));
+            Assert::IsTrue(runs[0].blockType == MarkDownBlockType::Paragraph);
+            Assert::IsTrue(runs[0].isBlockStart);
+            Assert::IsFalse(runs[0].isBold);
+
+            Assert::AreEqual<std::string>("b", text.substr(runs[1].textOffset, runs[1].textLength));
+            Assert::IsFalse(runs[1].isBlockStart);
+            Assert::IsTrue(runs[1].isBold);
+            Assert::IsFalse(runs[1].isItalic);
+
+            Assert::AreEqual<std::string>(" ", text.substr(runs[2].textOffset, runs[2].textLength));
+            Assert::IsFalse(runs[2].isBold);
+            Assert::IsFalse(runs[2].isLink);
+
+            Assert::AreEqual<std::string>("c ", text.substr(runs[3].textOffset, runs[3].textLength));
+            Assert::IsTrue(runs[3].isLink);
+            Assert::AreEqual<std::string>("https://e.com", runs[3].link);
+            Assert::IsFalse(runs[3].isItalic);
+
+            Assert::AreEqual<std::string>("d", text.substr(runs[4].textOffset, runs[4].textLength));
+            Assert::IsTrue(runs[4].isLink);
+            Assert::IsTrue(runs[4].isItalic);
+        }
+
+        TEST_METHOD(RunsTest_ListTest)
+        {
+            const std::string text = "Steps:\r3. first\r4. second\r\r- done";
+            MarkDownParser parser(text);
+            const auto runs = parser.TransformToRuns();
+            Assert::AreEqual<size_t>(4, runs.size());
+
+            Assert::AreEqual<std::string>("Steps:", text.substr(runs[0].textOffset, runs[0].textLength));
+            Assert::IsTrue(runs[0].blockType == MarkDownBlockType::Paragraph);
+
+            Assert::AreEqual<std::string>("first", text.substr(runs[1].textOffset, runs[1].textLength));
+            Assert::IsTrue(runs[1].blockType == MarkDownBlockType::NumberedListItem);
+            Assert::IsTrue(runs[1].isBlockStart);
+            Assert::AreEqual<std::string>("3", text.substr(runs[1].listStartOffset, runs[1].listStartLength));
+
+            Assert::AreEqual<std::string>("second", text.substr(runs[2].textOffset, runs[2].textLength));
+            Assert::IsTrue(runs[2].blockType == MarkDownBlockType::NumberedListItem);
+            Assert::IsTrue(runs[2].isBlockStart);
+            Assert::AreEqual<std::string>("3", text.substr(runs[2].listStartOffset, runs[2].listStartLength));
+
+            Assert::AreEqual<std::string>("done", text.substr(runs[3].textOffset, runs[3].textLength));
+            Assert::IsTrue(runs[3].blockType == MarkDownBlockType::BulletedListItem);
+            Assert::IsTrue(runs[3].isBlockStart);
+        }
+
+        TEST_METHOD(RunsTest_TextIsNotEscapedTest)
+        {
+            const std::string text = "\\[a\\] <b>";
+            MarkDownParser parser(text);
+            const auto runs = parser.TransformToRuns();
+            Assert::AreEqual<std::string>("<p>[a] &lt;b&gt;</p>", parser.TransformToHtml());
+            Assert::AreEqual<size_t>(2, runs.size());
+            Assert::AreEqual<std::string>("[a", text.substr(runs[0].textOffset, runs[0].textLength));
+            Assert::AreEqual<std::string>("] <b>", text.substr(runs[1].textOffset, runs[1].textLength));
+            Assert::IsFalse(runs[1].isBlockStart);
+        }
+
+        TEST_METHOD(RunsTest_EmptyBlocksTest)
+        {
+            MarkDownParser parser("");
+            const auto runs = parser.TransformToRuns();
+            Assert::AreEqual<size_t>(1, runs.size());
+            Assert::IsTrue(runs[0].blockType == MarkDownBlockType::Paragraph);
+            Assert::IsTrue(runs[0].isBlockStart);
+            Assert::AreEqual<size_t>(0, runs[0].textLength);
+
+            MarkDownParser parser1("- \r- a");
+            const auto runs1 = parser1.TransformToRuns();
+            Assert::AreEqual<size_t>(2, runs1.size());
+            Assert::AreEqual<size_t>(0, runs1[0].textLength);
+            Assert::IsTrue(runs1[0].isBlockStart);
+            Assert::AreEqual<size_t>(1, runs1[1].textLength);
+            Assert::IsTrue(runs1[1].isBlockStart);
+        }
+
+        TEST_METHOD(IncrementalTest_AppendedTextTest)
+        {
+            const std::string text = "Hi **there**, see [the docs](https://adaptivecards.io)\r- _one_\r- two\n\n1. a & b";
+            IncrementalMarkDownParser incremental;
+            Assert::AreEqual<std::string>("<p></p>", incremental.GetHtml());
+            for (size_t i = 0; i < text.size(); ++i)
+            {
+                incremental.AppendText(text.substr(i, 1));
+                MarkDownParser parser(text.substr(0, i + 1));
+                Assert::AreEqual<std::string>(parser.TransformToHtml(), incremental.GetHtml());
+                Assert::AreEqual<bool>(parser.HasHtmlTags(), incremental.HasHtmlTags());
+            }
+            Assert::AreEqual<std::string>(text, incremental.GetRawText());
+            Assert::IsTrue(incremental.IsEscaped());
+        }
+
+        TEST_METHOD(IncrementalTest_UnchangedHtmlTest)
+        {
+            IncrementalMarkDownParser incremental;
+            incremental.AppendText("done\n\n**a");
+            Assert::AreEqual<std::string>("<p>done\n\n**a</p>", incremental.GetHtml());
+            // the left emphasis may still be matched, the paragraph before it can't change
+            Assert::AreEqual<size_t>(7, incremental.AppendText("**"));
+            Assert::AreEqual<std::string>("<p>done\n\n<strong>a</strong></p>", incremental.GetHtml());
+        }
+
+        TEST_METHOD(IncrementalTest_LongParagraphTest)
+        {
+            IncrementalMarkDownParser incremental;
+            incremental.AppendText("one two");
+            // the text of the paragraph so far can't change, only what's appended to it
+            Assert::AreEqual<size_t>(10, incremental.AppendText(" three"));
+            Assert::AreEqual<size_t>(16, incremental.AppendText(" *four"));
+            Assert::AreEqual<size_t>(16, incremental.AppendText(" five*"));
+            Assert::AreEqual<std::string>("<p>one two three <em>four five</em></p>", incremental.GetHtml());
+        }
+
+        TEST_METHOD(IncrementalTest_UnclosedLinkTest)
+        {
+            IncrementalMarkDownParser incremental;
+            incremental.AppendText("a[i\r\rone");
+            // the '[' stays text until a ']' ends its link text
+            Assert::AreEqual<size_t>(11, incremental.AppendText(" two"));
+            Assert::AreEqual<std::string>("<p>a[i\r\rone two</p>", incremental.GetHtml());
+            incremental.AppendText("](https://adaptivecards.io)");
+            Assert::AreEqual<std::string>("<p>a<a href=\"https://adaptivecards.io\">i\r\rone two</a></p>", incremental.GetHtml());
+        }
     };
 }
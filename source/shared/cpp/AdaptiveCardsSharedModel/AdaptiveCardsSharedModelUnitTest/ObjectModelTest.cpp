@@ -7,11 +7,14 @@
 #include "ColumnSet.h"
 #include "Container.h"
 #include "FeatureRegistration.h"
+#include "ImageSet.h"
 #include "Media.h"
 #include "OpenUrlAction.h"
 #include "ParseContext.h"
 #include "ShowCardAction.h"
 #include "SubmitAction.h"
+#include "Table.h"
+#include "TableRow.h"
 #include "TextBlock.h"
 #include "TextInput.h"
 #include "ToggleInput.h"
@@ -611,6 +614,86 @@ namespace AdaptiveCardsSharedModelUnitTest
             }
         }
 
+        TEST_METHOD(ImplicitTypeLeavesJsonUntouchedTest)
+        {
+            const Json::Value json = ParseUtil::GetJsonValueFromString(R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "body": [
+                    {
+                        "type": "ColumnSet",
+                        "columns": [
+                            { "items": [ { "type": "ImageSet", "images": [ { "url": "http://adaptivecards.io/content/cats/1.png" } ] } ] }
+                        ]
+                    },
+                    {
+                        "type": "Table",
+                        "columns": [ { "width": 1 } ],
+                        "rows": [ { "cells": [ { "items": [ { "type": "TextBlock", "text": "cell" } ] } ] } ]
+                    }
+                ]
+            })");
+            const Json::Value original = json;
+
+            ParseContext context;
+            const auto card = AdaptiveCard::Deserialize(json, "1.5", context)->GetAdaptiveCard();
+
+            // implied types are handed to the parsers without being written into the card's JSON
+            Assert::IsTrue(original == json);
+
+            const auto columnSet = std::static_pointer_cast<ColumnSet>(card->GetBody().at(0));
+            const auto column = columnSet->GetColumns().at(0);
+            Assert::IsTrue(column->GetElementType() == CardElementType::Column);
+            Assert::IsTrue(column->GetItems().at(0)->GetElementType() == CardElementType::ImageSet);
+
+            const auto serialized = card->SerializeToJsonValue();
+            Assert::AreEqual("Column"s, serialized["body"][0]["columns"][0]["type"].asString());
+            Assert::AreEqual("Image"s, serialized["body"][0]["columns"][0]["items"][0]["images"][0]["type"].asString());
+            Assert::AreEqual("TableRow"s, serialized["body"][1]["rows"][0]["type"].asString());
+            Assert::AreEqual("TableCell"s, serialized["body"][1]["rows"][0]["cells"][0]["type"].asString());
+        }
+
+        TEST_METHOD(ImplicitTypeNullOrEmptyTest)
+        {
+            // a null or empty type is the same as no type for items whose type is implied
+            for (const std::string type : {"null"s, "\"\""s})
+            {
+                const std::string json = R"({
+                    "type": "AdaptiveCard",
+                    "version": "1.5",
+                    "body": [
+                        {
+                            "type": "ColumnSet",
+                            "columns": [
+                                { "type": )" + type + R"(, "items": [ { "type": "ImageSet", "images": [ { "type": )" + type +
+                                         R"(, "url": "http://adaptivecards.io/content/cats/1.png" } ] } ] }
+                            ]
+                        },
+                        {
+                            "type": "Table",
+                            "columns": [ { "width": 1 } ],
+                            "rows": [ { "type": )" + type + R"(, "cells": [ { "type": )" + type + R"(, "items": [] } ] } ]
+                        }
+                    ]
+                })";
+                const auto card = AdaptiveCard::DeserializeFromString(json, "1.5")->GetAdaptiveCard();
+
+                const auto column = std::static_pointer_cast<ColumnSet>(card->GetBody().at(0))->GetColumns().at(0);
+                Assert::AreEqual("Column"s, column->GetElementTypeString());
+                const auto imageSet = std::static_pointer_cast<ImageSet>(column->GetItems().at(0));
+                Assert::AreEqual("Image"s, imageSet->GetImages().at(0)->GetElementTypeString());
+                const auto row = std::static_pointer_cast<Table>(card->GetBody().at(1))->GetRows().at(0);
+                Assert::AreEqual("TableRow"s, row->GetElementTypeString());
+                Assert::AreEqual("TableCell"s, row->GetCells().at(0)->GetElementTypeString());
+
+                const auto serialized = card->SerializeToJsonValue();
+                Assert::AreEqual("Column"s, serialized["body"][0]["columns"][0]["type"].asString());
+                Assert::AreEqual("Image"s, serialized["body"][0]["columns"][0]["items"][0]["images"][0]["type"].asString());
+                Assert::AreEqual("TableRow"s, serialized["body"][1]["rows"][0]["type"].asString());
+                Assert::AreEqual("TableCell"s, serialized["body"][1]["rows"][0]["cells"][0]["type"].asString());
+            }
+        }
+
         TEST_METHOD(TextBlockStyleParsingTest)
         {
             std::string testjson{ R"(
@@ -663,5 +746,38 @@ namespace AdaptiveCardsSharedModelUnitTest
 				Assert::IsTrue(textBlock->GetStyle() == expectedStyles[i++]);
             }
         }
+
+        TEST_METHOD(DeserializeBatchTest)
+        {
+            std::vector<std::string> cards;
+            for (int i = 0; i < 50; ++i)
+            {
+                cards.push_back(R"({"type": "AdaptiveCard", "version": "1.2", "body": [{"type": "TextBlock", "text": ")" +
+                                std::to_string(i) + R"("}]})");
+            }
+            cards[7] = "{ not json";
+
+            std::vector<std::exception_ptr> errors;
+            const auto results = AdaptiveCard::DeserializeBatch(cards, "1.2", nullptr, nullptr, &errors, 4);
+            Assert::AreEqual(cards.size(), results.size());
+            Assert::AreEqual(cards.size(), errors.size());
+
+            for (size_t i = 0; i < cards.size(); ++i)
+            {
+                if (i == 7)
+                {
+                    Assert::IsTrue(results[i] == nullptr);
+                    Assert::IsTrue(errors[i] != nullptr);
+                    continue;
+                }
+
+                Assert::IsTrue(errors[i] == nullptr);
+                const auto textBlock = std::static_pointer_cast<TextBlock>(results[i]->GetAdaptiveCard()->GetBody().at(0));
+                Assert::AreEqual(std::to_string(i), textBlock->GetText());
+            }
+
+            // without an error list the first failure is rethrown
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeBatch(cards, "1.2", nullptr, nullptr); });
+        }
     };
 }
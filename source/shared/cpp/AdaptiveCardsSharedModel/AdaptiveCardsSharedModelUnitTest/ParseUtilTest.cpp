@@ -59,6 +59,53 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(jsonValue["foo"].asCString(), "bar", false);
         }
 
+        TEST_METHOD(GetJsonValueFromStringReuseTests)
+        {
+            // the per-thread reader carries nothing over from one string to the next, including failed ones
+            for (int i = 0; i < 3; ++i)
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([]() { ParseUtil::GetJsonValueFromString("{\"a\": [1, 2"); });
+                Assert::AreEqual("{\"a\":[1,2]}\n"s, ParseUtil::JsonToString(ParseUtil::GetJsonValueFromString("{\"a\": [1, 2] /* lenient */}")));
+                Assert::ExpectException<AdaptiveCardParseException>([]() { ParseUtil::GetJsonValueFromString("{\"key\": \"unterminated"); });
+                Assert::AreEqual("{\"key\\n\":\"v\"}\n"s, ParseUtil::JsonToString(ParseUtil::GetJsonValueFromString("{\"key\\n\": \"v\"}")));
+            }
+        }
+
+        TEST_METHOD(JsonToStringMatchesJsonCppTests)
+        {
+            Json::Value json;
+            json["text"] = "quote \" backslash \\ controls \n\t\x01 caf\xc3\xa9 \xf0\x9f\x98\x80 bad \xff";
+            json["numbers"].append(Json::Value::minInt64);
+            json["numbers"].append(Json::Value::maxUInt64);
+            json["numbers"].append(2.0);
+            json["numbers"].append(0.1);
+            json["numbers"].append(-2.5e-300);
+            json["empty"]["array"] = Json::Value(Json::arrayValue);
+            json["empty"]["object"] = Json::Value(Json::objectValue);
+            json["empty"]["string"] = "";
+            json["null"] = Json::Value();
+            json["b"] = true;
+            json["a"] = false;
+
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+            const std::string expected = Json::writeString(builder, json) + "\n";
+            Assert::AreEqual(expected, ParseUtil::JsonToString(json));
+
+            std::string buffer = "previous contents";
+            ParseUtil::JsonToString(json, buffer);
+            Assert::AreEqual(expected, buffer);
+
+            Assert::AreEqual("{\"a\":[1,2.5,\"x\"]}\n"s, ParseUtil::JsonToString(ParseUtil::GetJsonValueFromString("{\"a\": [1, 2.5, \"x\"]}")));
+
+            // a value larger than the per-thread buffer keeps doesn't affect the ones after it
+            Json::Value large;
+            large["text"] = std::string(100 * 1024, 'x');
+            Assert::AreEqual(std::string("{\"text\":\"") + std::string(100 * 1024, 'x') + "\"}\n", ParseUtil::JsonToString(large));
+            Assert::AreEqual(expected, ParseUtil::JsonToString(json));
+        }
+
         TEST_METHOD(ThrowIfNotJsonObjectTests)
         {
             Json::Value value;
@@ -90,6 +137,35 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(ParseUtil::TryGetTypeAsString(typedValue), typeName);
         }
 
+        TEST_METHOD(ImpliedTypeScopeTests)
+        {
+            auto value = s_GetValidJsonObject();
+            const std::string impliedType("Column");
+            {
+                ParseUtil::ImpliedTypeScope scope(value, impliedType);
+                Assert::AreEqual(impliedType, ParseUtil::GetTypeAsString(value));
+                ParseUtil::ExpectTypeString(value, CardElementType::Column);
+
+                // nothing nested inside the item has the implied type, and neither has an item with a type of its own
+                value["nested"] = s_GetValidJsonObject();
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetTypeAsString(value["nested"]); });
+                auto typedValue = s_GetJsonObjectWithType("Image"s);
+                Assert::AreEqual("Image"s, ParseUtil::GetTypeAsString(typedValue));
+            }
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetTypeAsString(value); });
+
+            // the implied type goes away when parsing the item throws, too
+            try
+            {
+                ParseUtil::ImpliedTypeScope scope(value, impliedType);
+                ParseUtil::ExpectTypeString(value, CardElementType::Image);
+            }
+            catch (const AdaptiveCardParseException&)
+            {
+            }
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetTypeAsString(value); });
+        }
+
         TEST_METHOD(ExpectTypeStringTests)
         {
             auto missingType = s_GetValidJsonObject();
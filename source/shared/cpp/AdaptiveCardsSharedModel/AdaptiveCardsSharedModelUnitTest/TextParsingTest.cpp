@@ -27,6 +27,13 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("&nbsp;"s, textBlockText);
         }
 
+        TEST_METHOD(HtmlEncodingAdjacentTest)
+        {
+            Assert::AreEqual("&<lt;"s, _GetTextBlockText("&&lt;lt;"));
+            Assert::AreEqual("\"\"<> & "s, _GetTextBlockText("&quot;&quot;&lt;&gt;&nbsp;&amp;&nbsp;"));
+            Assert::AreEqual("&amp<; trailing &"s, _GetTextBlockText("&amp&lt;; trailing &"));
+        }
+
         // Test for strings that should roundtrip without modification
         TEST_METHOD(HtmlEncodingRoundtripTests)
         {
@@ -34,7 +41,11 @@ namespace AdaptiveCardsSharedModelUnitTest
                 {
                     "some test text",
                     "&foo;",
-                    "&am p;"
+                    "&am p;",
+                    "",
+                    "&",
+                    "&lt",
+                    "&LT;"
                 };
 
             for (const auto& testString : testStrings)
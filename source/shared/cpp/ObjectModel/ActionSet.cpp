@@ -64,5 +64,8 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
 
 void ActionSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Actions});
+    SetKnownProperties(knownProperties);
 }
@@ -139,12 +139,15 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::IconUrl,
+                                          AdaptiveCardSchemaKey::Style,
+                                          AdaptiveCardSchemaKey::Title,
+                                          AdaptiveCardSchemaKey::Mode,
+                                          AdaptiveCardSchemaKey::Tooltip,
+                                          AdaptiveCardSchemaKey::IsEnabled});
+    SetKnownProperties(knownProperties);
 }
 
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -184,7 +187,7 @@ void BaseActionElement::DeserializeBaseProperties(ParseContext& context, const J
     element->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title));
     element->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
     element->SetStyle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Style, defaultStyle, false));
-    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeFromString));
+    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeTryFromString));
     element->SetTooltip(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Tooltip));
     element->SetIsEnabled(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsEnabled, true));
 }
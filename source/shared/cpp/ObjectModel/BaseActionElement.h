@@ -87,7 +87,10 @@ namespace AdaptiveCards
         DeserializeBaseProperties(context, json, baseActionElement);
 
         // Walk all properties and put any unknown ones in the additional properties json
-        HandleUnknownProperties(json, baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
+        if (context.GetCaptureAdditionalProperties())
+        {
+            HandleUnknownProperties(json, baseActionElement->GetKnownProperties(), baseActionElement->m_additionalProperties);
+        }
 
         return cardElement;
     }
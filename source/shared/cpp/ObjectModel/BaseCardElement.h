@@ -71,7 +71,10 @@ namespace AdaptiveCards
         DeserializeBaseProperties(context, json, baseCardElement);
 
         // Walk all properties and put any unknown ones in the additional properties json
-        HandleUnknownProperties(json, baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
+        if (context.GetCaptureAdditionalProperties())
+        {
+            HandleUnknownProperties(json, baseCardElement->GetKnownProperties(), baseCardElement->m_additionalProperties);
+        }
 
         return cardElement;
     }
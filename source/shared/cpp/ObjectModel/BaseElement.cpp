@@ -6,9 +6,24 @@
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
 
+#include <atomic>
+
 namespace AdaptiveCards
 {
-    unsigned int InternalId::s_currentInternalId = 1;
+    namespace
+    {
+        // Threads reserve ids in blocks so that parsing on many threads at once doesn't contend on a single counter.
+        // Ids only need to be unique, not ordered, so relaxed increments are enough.
+        constexpr unsigned int c_internalIdBlockSize = 1024;
+        std::atomic<unsigned int> s_nextInternalIdBlock{2};
+
+        thread_local unsigned int s_nextInternalId{0};
+        thread_local unsigned int s_internalIdBlockEnd{0};
+
+        // The last id handed out on this thread. Elements pick up their id through Current() while being constructed
+        // by the parser that just called Next(), so this must not observe ids handed out to other threads.
+        thread_local unsigned int s_currentInternalId{1};
+    }
 
     InternalId InternalId::Current()
     {
@@ -18,12 +33,18 @@ namespace AdaptiveCards
 
     InternalId InternalId::Next()
     {
-        s_currentInternalId++;
+        if (s_nextInternalId == s_internalIdBlockEnd)
+        {
+            s_nextInternalId = s_nextInternalIdBlock.fetch_add(c_internalIdBlockSize, std::memory_order_relaxed);
+            s_internalIdBlockEnd = s_nextInternalId + c_internalIdBlockSize;
+        }
+
+        s_currentInternalId = s_nextInternalId++;
 
         // handle overflow case
         if (s_currentInternalId == InternalId::Invalid)
         {
-            s_currentInternalId++;
+            return Next();
         }
 
         return Current();
@@ -47,10 +68,13 @@ namespace AdaptiveCards
 
     void BaseElement::PopulateKnownPropertiesSet()
     {
-        m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+        static const std::unordered_set<std::string> knownProperties =
+            ParseUtil::ExtendKnownProperties({},
+                                             {AdaptiveCardSchemaKey::Fallback,
+                                              AdaptiveCardSchemaKey::Id,
+                                              AdaptiveCardSchemaKey::Requires,
+                                              AdaptiveCardSchemaKey::Type});
+        m_knownProperties = &knownProperties;
     }
 
     const Json::Value& BaseElement::GetAdditionalProperties() const { return m_additionalProperties; }
@@ -63,25 +87,11 @@ namespace AdaptiveCards
     {
         for (const auto& requirement : m_requires)
         {
-            // special case for adaptive cards version
-            const auto& requirementName = requirement.first;
-            const auto& requirementVersion = requirement.second;
-            const auto& featureVersion = featureRegistration.GetFeatureVersion(requirementName);
-            if (featureVersion.empty())
+            // the host has to provide each requirement at an acceptable version
+            if (!featureRegistration.SupportsFeatureVersion(requirement.first, requirement.second))
             {
-                // host doesn't provide this requirement
                 return false;
             }
-            else
-            {
-                // host provides this requirement, but does it provide an acceptible version?
-                const SemanticVersion providesVersion{featureVersion};
-                if (providesVersion < requirementVersion)
-                {
-                    // host's provided version is too low
-                    return false;
-                }
-            }
         }
 
         return true;
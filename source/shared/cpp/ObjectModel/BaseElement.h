@@ -22,7 +22,7 @@ namespace AdaptiveCards
     {
     public:
         BaseElement() :
-            m_typeString{}, m_additionalProperties{}, m_requires{},
+            m_typeString{}, m_additionalProperties{}, m_knownProperties{}, m_requires{},
             m_fallbackContent(nullptr), m_id{}, m_internalId{InternalId::Current()}, m_fallbackType(FallbackType::None),
             m_canFallbackToAncestor(false)
         {
@@ -53,6 +53,7 @@ namespace AdaptiveCards
         const Json::Value& GetAdditionalProperties() const;
         void SetAdditionalProperties(Json::Value&& additionalProperties);
         void SetAdditionalProperties(const Json::Value& additionalProperties);
+        const std::unordered_set<std::string>& GetKnownProperties() const { return *m_knownProperties; }
 
         // Fallback and Requires support
         FallbackType GetFallbackType() const { return m_fallbackType; }
@@ -74,8 +75,12 @@ namespace AdaptiveCards
         void SetTypeString(const std::string& type) { m_typeString = type; }
         void SetCanFallbackToAncestor(bool value) { m_canFallbackToAncestor = value; }
 
+        // Points this element at the property names its type understands. The set is built once per type and shared
+        // by all of its instances, so it must outlive them: each constructor in the hierarchy builds a static one with
+        // ParseUtil::ExtendKnownProperties from GetKnownProperties() and sets it here.
+        void SetKnownProperties(const std::unordered_set<std::string>& knownProperties) { m_knownProperties = &knownProperties; }
+
         std::string m_typeString;
-        std::unordered_set<std::string> m_knownProperties;
         Json::Value m_additionalProperties;
 
     private:
@@ -83,6 +88,7 @@ namespace AdaptiveCards
         void ParseRequires(ParseContext& context, const Json::Value& json);
         void PopulateKnownPropertiesSet();
 
+        const std::unordered_set<std::string>* m_knownProperties;
         std::unordered_map<std::string, AdaptiveCards::SemanticVersion> m_requires;
         std::shared_ptr<BaseElement> m_fallbackContent;
         std::string m_id;
@@ -76,9 +76,12 @@ Json::Value BaseInputElement::SerializeToJsonValue() const
 
 void BaseInputElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsRequired),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ErrorMessage),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::IsRequired,
+                                          AdaptiveCardSchemaKey::ErrorMessage,
+                                          AdaptiveCardSchemaKey::Label});
+    SetKnownProperties(knownProperties);
 }
 
 std::shared_ptr<BaseInputElement> BaseInputElement::DeserializeBasePropertiesFromString(ParseContext& context,
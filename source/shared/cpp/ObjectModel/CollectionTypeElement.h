@@ -102,10 +102,10 @@ namespace AdaptiveCards
         collection->SetCanFallbackToAncestor(canFallbackToAncestor);
 
         collection->SetStyle(
-            ParseUtil::GetEnumValue<ContainerStyle>(value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+            ParseUtil::GetEnumValue<ContainerStyle>(value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
 
         collection->SetVerticalContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-            value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignmentFromString));
+            value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignmentTryFromString));
 
         collection->SetBleed(ParseUtil::GetBool(value, AdaptiveCardSchemaKey::Bleed, false));
 
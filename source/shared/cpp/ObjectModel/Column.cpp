@@ -95,12 +95,15 @@ Json::Value Column::SerializeToJsonValue() const
 
 void Column::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Items,
+                                          AdaptiveCardSchemaKey::Rtl,
+                                          AdaptiveCardSchemaKey::SelectAction,
+                                          AdaptiveCardSchemaKey::Width,
+                                          AdaptiveCardSchemaKey::Style,
+                                          AdaptiveCardSchemaKey::VerticalContentAlignment});
+    SetKnownProperties(knownProperties);
 }
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -128,15 +131,8 @@ std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context
     const auto& fallbackElement = column->GetFallbackContent();
     if (fallbackElement)
     {
-        bool isFallbackColumn;
-        try
-        {
-            isFallbackColumn = CardElementTypeFromString(fallbackElement->GetElementTypeString()) == CardElementType::Column;
-        }
-        catch (const std::out_of_range&)
-        {
-            isFallbackColumn = false;
-        }
+        const bool isFallbackColumn =
+            CardElementTypeTryFromString(fallbackElement->GetElementTypeString()) == CardElementType::Column;
 
         if (!isFallbackColumn)
         {
@@ -51,10 +51,13 @@ void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& va
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Bleed,
+                                          AdaptiveCardSchemaKey::Columns,
+                                          AdaptiveCardSchemaKey::SelectAction,
+                                          AdaptiveCardSchemaKey::Style});
+    SetKnownProperties(knownProperties);
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
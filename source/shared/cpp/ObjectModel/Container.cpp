@@ -88,12 +88,15 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
 
 void Container::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Bleed,
+                                          AdaptiveCardSchemaKey::Rtl,
+                                          AdaptiveCardSchemaKey::Style,
+                                          AdaptiveCardSchemaKey::VerticalContentAlignment,
+                                          AdaptiveCardSchemaKey::SelectAction,
+                                          AdaptiveCardSchemaKey::Items});
+    SetKnownProperties(knownProperties);
 }
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
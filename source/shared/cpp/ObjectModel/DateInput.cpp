@@ -100,8 +100,11 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
 
 void DateInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Max,
+                                          AdaptiveCardSchemaKey::Min,
+                                          AdaptiveCardSchemaKey::Value,
+                                          AdaptiveCardSchemaKey::Placeholder});
+    SetKnownProperties(knownProperties);
 }
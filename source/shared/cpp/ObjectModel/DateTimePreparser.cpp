@@ -26,11 +26,22 @@ DateTimePreparser::DateTimePreparser(std::string const& in) : m_hasDateTokens(fa
     ParseDateTime(in);
 }
 
-std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
+const std::vector<DateTimePreparsedToken>& DateTimePreparser::GetTokens() const
 {
     return m_textTokenCollection;
 }
 
+std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
+{
+    std::vector<std::shared_ptr<DateTimePreparsedToken>> textTokens;
+    textTokens.reserve(m_textTokenCollection.size());
+    for (const auto& token : m_textTokenCollection)
+    {
+        textTokens.emplace_back(std::make_shared<DateTimePreparsedToken>(token));
+    }
+    return textTokens;
+}
+
 bool DateTimePreparser::HasDateTokens() const
 {
     return m_hasDateTokens;
@@ -40,13 +51,13 @@ void DateTimePreparser::AddTextToken(const std::string& text, DateTimePreparsedT
 {
     if (!text.empty())
     {
-        m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, format));
+        m_textTokenCollection.emplace_back(text, format);
     }
 }
 
 void DateTimePreparser::AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format)
 {
-    m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, date, format));
+    m_textTokenCollection.emplace_back(text, date, format);
     m_hasDateTokens = true;
 }
 
@@ -55,7 +66,7 @@ std::string DateTimePreparser::Concatenate() const
     std::string formedString;
     for (const auto& piece : m_textTokenCollection)
     {
-        formedString += piece->GetText();
+        formedString += piece.GetText();
     }
     return formedString;
 }
@@ -103,193 +114,287 @@ constexpr time_t IntToTimeT(int timeToConvert)
 #pragma warning(pop)
 }
 
-void DateTimePreparser::ParseDateTime(const std::string& in)
+namespace
 {
-    if (in.find("{{") != std::string::npos)
+    // Fields of one {{DATE(...)}} or {{TIME(...)}} token, laid out as
+    // {{(DATE|TIME)(YYYY-MM-DDTHH:MM:SS(Z|(+|-)HH:MM)(, ?(SHORT|LONG|COMPACT))?)}}
+    struct DateTimeTokenMatch
     {
-        static const std::regex pattern(
-            "\\{\\{((DATE)|(TIME))\\((\\d{4})-{1}(\\d{2})-{1}(\\d{2})T(\\d{2}):{1}(\\d{2}):{1}(\\d{2})(Z|(([+-])(\\d{2}):{1}(\\d{2})))((((, ?SHORT)|(, ?LONG))|(, ?COMPACT))|)\\)\\}\\}");
-        std::smatch matches;
-        std::string text = in;
-        enum MatchIndex
+        size_t begin;
+        size_t end;
+        bool isDate;
+        int year;
+        int month;
+        int day;
+        int hour;
+        int minute;
+        int second;
+        // '+' or '-' for an explicit offset, 0 for Z
+        char timeZoneSign;
+        int timeZoneHours;
+        int timeZoneMinutes;
+        // 'S', 'L' or 'C' for SHORT, LONG or COMPACT, 0 if no style was given
+        char formatStyle;
+    };
+
+    bool MatchLiteral(const std::string& in, size_t& pos, const char* literal)
+    {
+        const size_t length = std::char_traits<char>::length(literal);
+        if (in.compare(pos, length, literal) != 0)
         {
-            IsDate = 2,
-            Year = 4,
-            Month,
-            Day,
-            Hour,
-            Min,
-            Sec,
-            TimeZone = 12,
-            TZHr,
-            TZMn,
-            Format,
-            Style,
-        };
-        std::vector<int> indexer = {Year, Month, Day, Hour, Min, Sec, TZHr, TZMn};
+            return false;
+        }
+        pos += length;
+        return true;
+    }
 
-        while (std::regex_search(text, matches, pattern))
+    bool MatchDigits(const std::string& in, size_t& pos, size_t count, int& value)
+    {
+        if (in.length() - pos < count)
         {
-            int formatStyle{};
-            // Date is matched
-            const bool isDate = matches[IsDate].matched;
-            int hours{}, minutes{};
-            struct tm parsedTm
-            {
-            };
-            std::vector<int*> addrs = {
-                &parsedTm.tm_year, &parsedTm.tm_mon, &parsedTm.tm_mday, &parsedTm.tm_hour, &parsedTm.tm_min, &parsedTm.tm_sec, &hours, &minutes};
+            return false;
+        }
 
-            if (matches[Style].matched)
+        int result = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const char ch = in[pos + i];
+            if (ch < '0' || ch > '9')
             {
-                // match for long/short/compact
-                bool formatHasSpace = matches[Format].str().at(1) == ' ';
-                const int formatStartIndex = formatHasSpace ? 2 : 1;
-                formatStyle = matches[Format].str().at(formatStartIndex);
+                return false;
             }
+            result = result * 10 + (ch - '0');
+        }
+        value = result;
+        pos += count;
+        return true;
+    }
+
+    // Tries to match a whole token starting at the "{{" at match.begin
+    bool MatchDateTimeToken(const std::string& in, DateTimeTokenMatch& match)
+    {
+        size_t pos = match.begin + 2;
+        if (MatchLiteral(in, pos, "DATE("))
+        {
+            match.isDate = true;
+        }
+        else if (MatchLiteral(in, pos, "TIME("))
+        {
+            match.isDate = false;
+        }
+        else
+        {
+            return false;
+        }
 
-            AddTextToken(matches.prefix().str(), DateTimePreparsedTokenFormat::RegularString);
+        if (!(MatchDigits(in, pos, 4, match.year) && MatchLiteral(in, pos, "-") && MatchDigits(in, pos, 2, match.month) &&
+              MatchLiteral(in, pos, "-") && MatchDigits(in, pos, 2, match.day) && MatchLiteral(in, pos, "T") &&
+              MatchDigits(in, pos, 2, match.hour) && MatchLiteral(in, pos, ":") && MatchDigits(in, pos, 2, match.minute) &&
+              MatchLiteral(in, pos, ":") && MatchDigits(in, pos, 2, match.second)))
+        {
+            return false;
+        }
 
-            if (!isDate && formatStyle)
+        match.timeZoneSign = 0;
+        match.timeZoneHours = 0;
+        match.timeZoneMinutes = 0;
+        if (!MatchLiteral(in, pos, "Z"))
+        {
+            if (pos == in.length() || (in[pos] != '+' && in[pos] != '-'))
+            {
+                return false;
+            }
+            match.timeZoneSign = in[pos++];
+            if (!(MatchDigits(in, pos, 2, match.timeZoneHours) && MatchLiteral(in, pos, ":") &&
+                  MatchDigits(in, pos, 2, match.timeZoneMinutes)))
             {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-                text = matches.suffix().str();
-                continue;
+                return false;
             }
+        }
 
-            for (unsigned int idx = 0; idx < indexer.size(); idx++)
+        match.formatStyle = 0;
+        if (MatchLiteral(in, pos, ","))
+        {
+            MatchLiteral(in, pos, " ");
+            if (MatchLiteral(in, pos, "SHORT"))
             {
-                if (matches[indexer.at(idx)].matched)
-                {
-                    // get indexes for time attributes to index into corresponding matches
-                    // and convert it to string
-                    *(addrs.at(idx)) = stoi(matches[indexer.at(idx)]);
-                }
+                match.formatStyle = 'S';
+            }
+            else if (MatchLiteral(in, pos, "LONG"))
+            {
+                match.formatStyle = 'L';
             }
+            else if (MatchLiteral(in, pos, "COMPACT"))
+            {
+                match.formatStyle = 'C';
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if (!MatchLiteral(in, pos, ")}}"))
+        {
+            return false;
+        }
+        match.end = pos;
+        return true;
+    }
 
-            // check for date and time validation
-            if (IsValidTimeAndDate(parsedTm, hours, minutes))
+    // Finds the next token at or after `from`, the same way a regex_search for the token pattern would
+    bool FindDateTimeToken(const std::string& in, size_t from, DateTimeTokenMatch& match)
+    {
+        for (size_t candidate = in.find("{{", from); candidate != std::string::npos; candidate = in.find("{{", candidate + 1))
+        {
+            match.begin = candidate;
+            if (MatchDateTimeToken(in, match))
             {
-                time_t offset{};
-                // maches offset sign,
-                // Z == UTC,
-                // + == time added from UTC
-                // - == time subtracted from UTC
-                if (matches[TimeZone].matched)
-                {
-                    // converts to seconds
-                    hours *= 3600;
-                    minutes *= 60;
-                    offset = IntToTimeT(hours) + IntToTimeT(minutes);
-
-                    wchar_t zone = matches[TimeZone].str().at(0);
-                    // time zone offset calculation
-                    if (zone == '+')
-                    {
-                        offset *= -1;
-                    }
-                }
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+void DateTimePreparser::ParseDateTime(const std::string& in)
+{
+    size_t textStart = 0;
+    DateTimeTokenMatch match{};
+    while (FindDateTimeToken(in, textStart, match))
+    {
+        const std::string matchedText = in.substr(match.begin, match.end - match.begin);
+        const bool isDate = match.isDate;
+        const int formatStyle = match.formatStyle;
 
-                // measured from year 1900
-                parsedTm.tm_year -= 1900;
-                parsedTm.tm_mon -= 1;
+        AddTextToken(in.substr(textStart, match.begin - textStart), DateTimePreparsedTokenFormat::RegularString);
+        textStart = match.end;
 
-                time_t utc{};
-                // converts to ticks in UTC
-                utc = mktime(&parsedTm);
-                if (utc == -1)
+        if (!isDate && formatStyle)
+        {
+            AddTextToken(matchedText, DateTimePreparsedTokenFormat::RegularString);
+            continue;
+        }
+
+        int hours = match.timeZoneHours;
+        int minutes = match.timeZoneMinutes;
+        struct tm parsedTm
+        {
+        };
+        parsedTm.tm_year = match.year;
+        parsedTm.tm_mon = match.month;
+        parsedTm.tm_mday = match.day;
+        parsedTm.tm_hour = match.hour;
+        parsedTm.tm_min = match.minute;
+        parsedTm.tm_sec = match.second;
+
+        // check for date and time validation
+        if (IsValidTimeAndDate(parsedTm, hours, minutes))
+        {
+            time_t offset{};
+            // maches offset sign,
+            // Z == UTC,
+            // + == time added from UTC
+            // - == time subtracted from UTC
+            if (match.timeZoneSign)
+            {
+                // converts to seconds
+                hours *= 3600;
+                minutes *= 60;
+                offset = IntToTimeT(hours) + IntToTimeT(minutes);
+
+                // time zone offset calculation
+                if (match.timeZoneSign == '+')
                 {
-                    AddTextToken(matches[0], DateTimePreparsedTokenFormat::RegularString);
+                    offset *= -1;
                 }
+            }
+
+            // measured from year 1900
+            parsedTm.tm_year -= 1900;
+            parsedTm.tm_mon -= 1;
+
+            time_t utc{};
+            // converts to ticks in UTC
+            utc = mktime(&parsedTm);
+            if (utc == -1)
+            {
+                AddTextToken(matchedText, DateTimePreparsedTokenFormat::RegularString);
+            }
 
 // Disable "array to pointer decay" check for tzOffsetBuff since we can't change strftime's signature
 #pragma warning(push)
 #pragma warning(disable : 26485)
-                char tzOffsetBuff[6]{};
-                // gets local time zone offset
-                strftime(tzOffsetBuff, 6, "%z", &parsedTm);
-                std::string localTimeZoneOffsetStr(tzOffsetBuff);
-                const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
-                offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
-                // add offset to utc
-                utc += offset;
-                struct tm result
-                {
-                };
+            char tzOffsetBuff[6]{};
+            // gets local time zone offset
+            strftime(tzOffsetBuff, 6, "%z", &parsedTm);
+            std::string localTimeZoneOffsetStr(tzOffsetBuff);
+            const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
+            offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
+            // add offset to utc
+            utc += offset;
+            struct tm result
+            {
+            };
 #pragma warning(pop)
 
-                // converts to local time from utc
-                if (!LOCALTIME(&result, &utc))
+            // converts to local time from utc
+            if (!LOCALTIME(&result, &utc))
+            {
+                // localtime() set dst, put_time adjusts time accordingly which is not what we want since
+                // we have already taken cared of it in our calculation
+                if (result.tm_isdst == 1)
                 {
-                    // localtime() set dst, put_time adjusts time accordingly which is not what we want since
-                    // we have already taken cared of it in our calculation
-                    if (result.tm_isdst == 1)
-                    {
-                        result.tm_hour -= 1;
-                    }
+                    result.tm_hour -= 1;
+                }
 
-                    if (isDate)
-                    {
-                        switch (formatStyle)
-                        {
-                        // SHORT Style
-                        case 'S':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateShort);
-                            break;
-                        // LONG Style
-                        case 'L':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateLong);
-                            break;
-                        // COMPACT or DEFAULT Style
-                        case 'C':
-                        default:
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateCompact);
-                            break;
-                        }
-                    }
-                    else
+                if (isDate)
+                {
+                    switch (formatStyle)
                     {
-                        std::ostringstream parsedTime;
-                        parsedTime << std::put_time(&result, "%I:%M %p");
-                        AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
+                    // SHORT Style
+                    case 'S':
+                        AddDateToken(matchedText, result, DateTimePreparsedTokenFormat::DateShort);
+                        break;
+                    // LONG Style
+                    case 'L':
+                        AddDateToken(matchedText, result, DateTimePreparsedTokenFormat::DateLong);
+                        break;
+                    // COMPACT or DEFAULT Style
+                    case 'C':
+                    default:
+                        AddDateToken(matchedText, result, DateTimePreparsedTokenFormat::DateCompact);
+                        break;
                     }
                 }
+                else
+                {
+                    std::ostringstream parsedTime;
+                    parsedTime << std::put_time(&result, "%I:%M %p");
+                    AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
+                }
             }
-            else
-            {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-            }
-
-            text = matches.suffix().str();
         }
-
-        AddTextToken(text, DateTimePreparsedTokenFormat::RegularString);
-    }
-    else
-    {
-        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+        else
+        {
+            AddTextToken(matchedText, DateTimePreparsedTokenFormat::RegularString);
+        }
     }
+
+    AddTextToken(in.substr(textStart), DateTimePreparsedTokenFormat::RegularString);
 }
 
 // Parses a time of the form HH:MM
 bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes)
 {
-    std::smatch subMatches;
-    static const std::regex timeMatch(R"regex(^(\d{2}):(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, timeMatch))
+    size_t pos = 0;
+    int parsedHours{}, parsedMinutes{};
+    if (string.length() == 5 && MatchDigits(string, pos, 2, parsedHours) && MatchLiteral(string, pos, ":") &&
+        MatchDigits(string, pos, 2, parsedMinutes) && IsValidTime(parsedHours, parsedMinutes, 0))
     {
-        if (subMatches[1].matched && subMatches[2].matched)
-        {
-            unsigned int parsedHours = std::stoul(subMatches[1]);
-            unsigned int parsedMinutes = std::stoul(subMatches[2]);
-
-            if (IsValidTime(parsedHours, parsedMinutes, 0))
-            {
-                hours = parsedHours;
-                minutes = parsedMinutes;
-                return true;
-            }
-        }
+        hours = parsedHours;
+        minutes = parsedMinutes;
+        return true;
     }
     return false;
 }
@@ -297,24 +402,16 @@ bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned i
 // Parses a date of the form YYYY-MM-DD
 bool DateTimePreparser::TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day)
 {
-    std::smatch subMatches;
-    static const std::regex dateMatch(R"regex(^(\d{4})-(\d{2})-(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, dateMatch))
+    size_t pos = 0;
+    int parsedYear{}, parsedMonth{}, parsedDay{};
+    if (string.length() == 10 && MatchDigits(string, pos, 4, parsedYear) && MatchLiteral(string, pos, "-") &&
+        MatchDigits(string, pos, 2, parsedMonth) && MatchLiteral(string, pos, "-") && MatchDigits(string, pos, 2, parsedDay) &&
+        IsValidDate(parsedYear, parsedMonth, parsedDay))
     {
-        if (subMatches[1].matched && subMatches[2].matched && subMatches[3].matched)
-        {
-            unsigned int parsedYear = std::stoul(subMatches[1]);
-            unsigned int parsedMonth = std::stoul(subMatches[2]);
-            unsigned int parsedDay = std::stoul(subMatches[3]);
-
-            if (IsValidDate(parsedYear, parsedMonth, parsedDay))
-            {
-                year = parsedYear;
-                month = parsedMonth;
-                day = parsedDay;
-                return true;
-            }
-        }
+        year = parsedYear;
+        month = parsedMonth;
+        day = parsedDay;
+        return true;
     }
     return false;
 }
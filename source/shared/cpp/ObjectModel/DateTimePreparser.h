@@ -12,6 +12,9 @@ namespace AdaptiveCards
     public:
         DateTimePreparser();
         DateTimePreparser(const std::string& in);
+        // The tokens, stored contiguously
+        const std::vector<DateTimePreparsedToken>& GetTokens() const;
+        // A copy of each token; GetTokens avoids the allocations
         std::vector<std::shared_ptr<DateTimePreparsedToken>> GetTextTokens() const;
         bool HasDateTokens() const;
         static bool TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes);
@@ -26,7 +29,7 @@ namespace AdaptiveCards
         static inline bool IsValidTime(const int hours, const int minutes, const int seconds);
         static inline bool IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes);
 
-        std::vector<std::shared_ptr<DateTimePreparsedToken>> m_textTokenCollection;
+        std::vector<DateTimePreparsedToken> m_textTokenCollection;
         bool m_hasDateTokens;
     };
 }
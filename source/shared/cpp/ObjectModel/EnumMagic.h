@@ -3,25 +3,45 @@
 #pragma once
 #include "pch.h"
 
+#include <array>
+#include <string_view>
+
 namespace AdaptiveCards
 {
+    // Locale-independent ASCII case folding. Schema keys and type names are ASCII, and folding only ASCII keeps the
+    // hash and equality functors below consistent with each other regardless of the process locale.
+    constexpr unsigned char AsciiToLower(unsigned char c) noexcept
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c | 0x20) : c;
+    }
+
     struct CaseInsensitiveEqualTo
     {
-        bool operator()(const std::string& lhs, const std::string& rhs) const noexcept
+        bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
         {
             return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](unsigned char a, unsigned char b) {
-                return std::toupper(a) == std::toupper(b);
+                return AsciiToLower(a) == AsciiToLower(b);
             });
         }
     };
 
+    // FNV-1a over the case-folded bytes. Only strings that differ purely in ASCII case are guaranteed to collide, so
+    // keys like "Image" and "Giema" land in different buckets.
     struct CaseInsensitiveHash
     {
-        size_t operator()(const std::string& keyval) const noexcept
+        size_t operator()(std::string_view keyval) const noexcept
         {
-            return std::accumulate(keyval.cbegin(), keyval.cend(), size_t{0}, [](size_t acc, unsigned char c) {
-                return acc + std::toupper(c);
-            });
+            constexpr bool is64Bit = sizeof(size_t) >= 8;
+            constexpr size_t fnvOffsetBasis = is64Bit ? static_cast<size_t>(14695981039346656037ULL) : size_t{2166136261U};
+            constexpr size_t fnvPrime = is64Bit ? static_cast<size_t>(1099511628211ULL) : size_t{16777619U};
+
+            size_t hash = fnvOffsetBasis;
+            for (const unsigned char c : keyval)
+            {
+                hash ^= AsciiToLower(c);
+                hash *= fnvPrime;
+            }
+            return hash;
         }
     };
 
@@ -32,76 +52,233 @@ namespace AdaptiveCards
 
     namespace EnumHelpers
     {
-        // Manage mapping T<->std::string using two internal unordered_maps.
+        template<typename T> struct EnumEntry
+        {
+            T value;
+            std::string_view name;
+        };
+
+        // Additional name accepted when parsing, written {"name", value} like the reverse mapping it extends
+        template<typename T> struct EnumAlias
+        {
+            std::string_view name;
+            T value;
+        };
+
+        constexpr int CaseInsensitiveCompare(std::string_view lhs, std::string_view rhs) noexcept
+        {
+            const size_t length = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+            for (size_t i = 0; i < length; ++i)
+            {
+                const unsigned char a = AsciiToLower(static_cast<unsigned char>(lhs[i]));
+                const unsigned char b = AsciiToLower(static_cast<unsigned char>(rhs[i]));
+                if (a != b)
+                {
+                    return a < b ? -1 : 1;
+                }
+            }
+            return lhs.size() == rhs.size() ? 0 : (lhs.size() < rhs.size() ? -1 : 1);
+        }
+
+        // Stable insertion sort usable in constant expressions (std::sort isn't constexpr until C++20).
+        template<typename T, size_t N, typename Less> constexpr void ConstexprSort(std::array<EnumEntry<T>, N>& entries, Less less)
+        {
+            for (size_t i = 1; i < N; ++i)
+            {
+                const EnumEntry<T> current = entries[i];
+                size_t j = i;
+                for (; j > 0 && less(current, entries[j - 1]); --j)
+                {
+                    entries[j] = entries[j - 1];
+                }
+                entries[j] = current;
+            }
+        }
+
+        // Compile-time tables for one enum. byValue is sorted by enumerator value and backs the T->string direction;
+        // byName is sorted by case-folded name and backs the string->T direction. When a name maps to more than one
+        // value, the first declared (aliases first) wins.
+        template<typename T, size_t N, size_t M> struct EnumTable
+        {
+            std::array<EnumEntry<T>, N> byValue;
+            std::array<EnumEntry<T>, N + M> byName;
+        };
+
+        template<typename T, size_t N, size_t M>
+        constexpr EnumTable<T, N, M> MakeEnumTable(const EnumEntry<T> (&values)[N], const EnumAlias<T> (&aliases)[M])
+        {
+            EnumTable<T, N, M> table{};
+            for (size_t i = 0; i < M; ++i)
+            {
+                table.byName[i] = {aliases[i].value, aliases[i].name};
+            }
+            for (size_t i = 0; i < N; ++i)
+            {
+                table.byValue[i] = values[i];
+                table.byName[M + i] = values[i];
+            }
+
+            ConstexprSort(table.byValue, [](const EnumEntry<T>& a, const EnumEntry<T>& b) { return a.value < b.value; });
+            ConstexprSort(table.byName, [](const EnumEntry<T>& a, const EnumEntry<T>& b) {
+                return CaseInsensitiveCompare(a.name, b.name) < 0;
+            });
+            return table;
+        }
+
+        // Initialize with a single list -> the reverse mapping is generated from it
+        template<typename T, size_t N> constexpr EnumTable<T, N, 0> MakeEnumTable(const EnumEntry<T> (&values)[N])
+        {
+            EnumTable<T, N, 0> table{};
+            for (size_t i = 0; i < N; ++i)
+            {
+                table.byValue[i] = values[i];
+                table.byName[i] = values[i];
+            }
+
+            ConstexprSort(table.byValue, [](const EnumEntry<T>& a, const EnumEntry<T>& b) { return a.value < b.value; });
+            ConstexprSort(table.byName, [](const EnumEntry<T>& a, const EnumEntry<T>& b) {
+                return CaseInsensitiveCompare(a.name, b.name) < 0;
+            });
+            return table;
+        }
+
+        // Names indexed directly by enumerator value, for enums whose values are dense from 0. Values without a name
+        // map to an empty string_view. A value >= Count fails constant evaluation.
+        template<typename T, size_t Count, size_t N, size_t M>
+        constexpr std::array<std::string_view, Count> MakeDenseNameTable(const EnumTable<T, N, M>& table)
+        {
+            std::array<std::string_view, Count> names{};
+            for (size_t i = 0; i < N; ++i)
+            {
+                names[static_cast<size_t>(table.byValue[i].value)] = table.byValue[i].name;
+            }
+            return names;
+        }
+
+        // Owned strings for the T->std::string direction, built on first use.
+        template<typename T, size_t N, size_t M> std::array<std::string, N> MakeStringTable(const EnumTable<T, N, M>& table)
+        {
+            std::array<std::string, N> strings;
+            for (size_t i = 0; i < N; ++i)
+            {
+                strings[i] = std::string{table.byValue[i].name};
+            }
+            return strings;
+        }
+
+        // Manage mapping T<->string over an EnumTable using binary search. Constant-initialized, so there is no
+        // static-initialization cost and lookups never allocate.
         template<typename T> class EnumMapping
         {
         public:
-            // Initialize with a single list -> automatically generate reverse mapping
-            EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) :
-                _enumToString{t.begin(), t.end()}, _stringToEnum(t.size())
+            template<size_t N, size_t M>
+            constexpr EnumMapping(const EnumTable<T, N, M>& table) :
+                _byValue{table.byValue.data()}, _valueCount{N}, _byName{table.byName.data()}, _nameCount{N + M}
             {
-                _GenerateStringToEnumMap();
             }
 
-            // Initialize with two lists -> t1 is our forward list and t2 contains additional terms to use in addition
-            // to the generated reverse mapping
-            EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1,
-                        const std::initializer_list<std::pair<std::string, T>>& t2) :
-                _enumToString{t1.begin(), t1.end()},
-                _stringToEnum(t2.begin(), t2.end())
+            // Position of t in the value table, or std::nullopt if t has no string form
+            std::optional<size_t> indexOf(T t) const noexcept
             {
-                _GenerateStringToEnumMap();
+                const auto end = _byValue + _valueCount;
+                const auto entry = std::lower_bound(_byValue, end, t, [](const EnumEntry<T>& e, T value) {
+                    return e.value < value;
+                });
+                if (entry == end || entry->value != t)
+                {
+                    return std::nullopt;
+                }
+                return static_cast<size_t>(entry - _byValue);
             }
 
-            const std::string& toString(T t) const { return _enumToString.at(t); }
-            T fromString(const std::string& str) const { return _stringToEnum.at(str); }
+            std::optional<std::string_view> toStringView(T t) const noexcept
+            {
+                const auto index = indexOf(t);
+                if (!index.has_value())
+                {
+                    return std::nullopt;
+                }
+                return _byValue[index.value()].name;
+            }
 
-        private:
-            inline void _GenerateStringToEnumMap()
+            std::optional<T> tryFromString(std::string_view str) const noexcept
             {
-                for (const auto& kv : _enumToString)
+                const auto end = _byName + _nameCount;
+                const auto entry = std::lower_bound(_byName, end, str, [](const EnumEntry<T>& e, std::string_view name) {
+                    return CaseInsensitiveCompare(e.name, name) < 0;
+                });
+                if (entry == end || CaseInsensitiveCompare(entry->name, str) != 0)
                 {
-                    _stringToEnum.emplace(kv.second, kv.first);
+                    return std::nullopt;
                 }
+                return entry->value;
             }
 
-            const std::unordered_map<T, std::string, EnumHash> _enumToString;
-            std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> _stringToEnum;
+            T fromString(const std::string& str) const
+            {
+                const auto value = tryFromString(str);
+                if (!value.has_value())
+                {
+                    throw std::out_of_range("Unknown enum string: " + str);
+                }
+                return value.value();
+            }
+
+        private:
+            const EnumEntry<T>* _byValue;
+            size_t _valueCount;
+            const EnumEntry<T>* _byName;
+            size_t _nameCount;
         };
     }
 
 // Provides forward declaration for EnumHelpers mapping accessor as well as global mapping functions.
-#define DECLARE_ADAPTIVECARD_ENUM(ENUMTYPE)                  \
-    namespace EnumHelpers                                    \
-    {                                                        \
-        const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum();  \
-    }                                                        \
-    const std::string& ENUMTYPE##ToString(const ENUMTYPE t); \
-    ENUMTYPE ENUMTYPE##FromString(const std::string& t);
-
-#define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...)                \
-    namespace EnumHelpers                                                 \
-    {                                                                     \
-        const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum()                \
-        {                                                                 \
-            static const EnumMapping<ENUMTYPE> generatedEnum __VA_ARGS__; \
-            return generatedEnum;                                         \
-        }                                                                 \
-    }                                                                     \
-    const std::string& ENUMTYPE##ToString(const ENUMTYPE t) { return EnumHelpers::get##ENUMTYPE##Enum().toString(t); }
-
-// Define mapping functions for ENUMTYPE. Throw an exception if caller passes in a string that doesn't map
-#define DEFINE_ADAPTIVECARD_ENUM(ENUMTYPE, ...)                \
-    _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__);      \
-    ENUMTYPE ENUMTYPE##FromString(const std::string& t)              \
-    {                                                                \
-        try                                                          \
-        {                                                            \
-            return EnumHelpers::get##ENUMTYPE##Enum().fromString(t); \
-        }                                                            \
-        catch (const std::out_of_range&)                             \
-        {                                                            \
-            throw std::out_of_range("Invalid " #ENUMTYPE ": " + t);  \
-        }                                                            \
+#define DECLARE_ADAPTIVECARD_ENUM(ENUMTYPE)                                            \
+    namespace EnumHelpers                                                              \
+    {                                                                                  \
+        const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum();                            \
+    }                                                                                  \
+    const std::string& ENUMTYPE##ToString(const ENUMTYPE t);                           \
+    ENUMTYPE ENUMTYPE##FromString(const std::string& t);                               \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(std::string_view t) noexcept;
+
+// The mapping list is either a single list of {value, "name"} pairs, or that list followed by a second list of
+// additional {value, "name"} terms accepted when parsing (e.g. back compat spellings).
+#define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...)                                                  \
+    namespace EnumHelpers                                                                                   \
+    {                                                                                                       \
+        static constexpr auto s_##ENUMTYPE##Table = MakeEnumTable<ENUMTYPE>(__VA_ARGS__);                   \
+        const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum()                                                  \
+        {                                                                                                   \
+            static constexpr EnumMapping<ENUMTYPE> generatedEnum{s_##ENUMTYPE##Table};                      \
+            return generatedEnum;                                                                           \
+        }                                                                                                   \
+    }                                                                                                       \
+    const std::string& ENUMTYPE##ToString(const ENUMTYPE t)                                                 \
+    {                                                                                                       \
+        static const auto strings = EnumHelpers::MakeStringTable(EnumHelpers::s_##ENUMTYPE##Table);         \
+        const auto index = EnumHelpers::get##ENUMTYPE##Enum().indexOf(t);                                   \
+        if (!index.has_value())                                                                             \
+        {                                                                                                   \
+            throw std::out_of_range("Invalid " #ENUMTYPE " value");                                         \
+        }                                                                                                   \
+        return strings[index.value()];                                                                      \
+    }                                                                                                       \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(std::string_view t) noexcept                            \
+    {                                                                                                       \
+        return EnumHelpers::get##ENUMTYPE##Enum().tryFromString(t);                                         \
+    }
+
+// Define mapping functions for ENUMTYPE. FromString throws if the caller passes in a string that doesn't map;
+// TryFromString returns std::nullopt instead.
+#define DEFINE_ADAPTIVECARD_ENUM(ENUMTYPE, ...)                            \
+    _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__);            \
+    ENUMTYPE ENUMTYPE##FromString(const std::string& t)                    \
+    {                                                                      \
+        if (const auto value = ENUMTYPE##TryFromString(t))                 \
+        {                                                                  \
+            return value.value();                                          \
+        }                                                                  \
+        throw std::out_of_range("Invalid " #ENUMTYPE ": " + t);            \
     }
 }
@@ -200,6 +200,15 @@ namespace AdaptiveCards
             {AdaptiveCardSchemaKey::Width, "width"},
             {AdaptiveCardSchemaKey::Wrap, "wrap"}});
 
+    std::string_view AdaptiveCardSchemaKeyToStringView(const AdaptiveCardSchemaKey key) noexcept
+    {
+        constexpr size_t keyCount = static_cast<size_t>(AdaptiveCardSchemaKey::Wrap) + 1;
+        static constexpr auto names = EnumHelpers::MakeDenseNameTable<AdaptiveCardSchemaKey, keyCount>(EnumHelpers::s_AdaptiveCardSchemaKeyTable);
+
+        const auto index = static_cast<size_t>(key);
+        return index < names.size() ? names[index] : std::string_view{};
+    }
+
     DEFINE_ADAPTIVECARD_ENUM(CardElementType, {
             {CardElementType::ActionSet, "ActionSet"},
             {CardElementType::AdaptiveCard, "AdaptiveCard"},
@@ -253,14 +262,14 @@ namespace AdaptiveCards
             {SeparatorThickness::Default, "default"},
             {SeparatorThickness::Thick, "thick"}});
 
-    DEFINE_ADAPTIVECARD_ENUM(ImageStyle, {
+    DEFINE_ADAPTIVECARD_ENUM(ImageStyle,
             {
                 {ImageStyle::Default, "default"},
                 {ImageStyle::Person, "person"}
             },
             {
                 {"normal", ImageStyle::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            });
 
     DEFINE_ADAPTIVECARD_ENUM(VerticalAlignment, {
         { VerticalAlignment::Top, "top" },
@@ -298,7 +307,7 @@ namespace AdaptiveCards
             {TextStyle::Default, "default"},
             {TextStyle::Heading, "heading"}});
 
-    DEFINE_ADAPTIVECARD_ENUM(TextWeight, {
+    DEFINE_ADAPTIVECARD_ENUM(TextWeight,
             {
                 {TextWeight::Bolder, "Bolder"},
                 {TextWeight::Lighter, "Lighter"},
@@ -306,9 +315,9 @@ namespace AdaptiveCards
             },
             {
                 {"Normal", TextWeight::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            });
 
-    DEFINE_ADAPTIVECARD_ENUM(TextSize, {
+    DEFINE_ADAPTIVECARD_ENUM(TextSize,
             {
                 {TextSize::ExtraLarge, "ExtraLarge"},
                 {TextSize::Large, "Large"},
@@ -318,7 +327,7 @@ namespace AdaptiveCards
             },
             {
                 {"Normal", TextSize::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            });
 
     DEFINE_ADAPTIVECARD_ENUM(FontType, {
             {FontType::Default, "Default"},
@@ -204,6 +204,10 @@ namespace AdaptiveCards
     };
     DECLARE_ADAPTIVECARD_ENUM(AdaptiveCardSchemaKey);
 
+    // Interned JSON property name for key, from a table indexed by the key's value. Empty for keys that have no
+    // string form. The view refers to static storage.
+    std::string_view AdaptiveCardSchemaKeyToStringView(const AdaptiveCardSchemaKey key) noexcept;
+
     enum class CardElementType
     {
         // When the order of existing enums are changed, corresponding changes are needed in iOS (ACOBaseCardElement.h)
@@ -249,6 +253,7 @@ namespace AdaptiveCards
 
     enum class TextSize
     {
+        // When a value is added after the last one, update the table sizes in CompiledHostConfig (HostConfig.h)
         Small = 0,
         Default,
         Medium,
@@ -259,6 +264,7 @@ namespace AdaptiveCards
 
     enum class TextWeight
     {
+        // When a value is added after the last one, update the table sizes in CompiledHostConfig (HostConfig.h)
         Lighter = 0,
         Default,
         Bolder
@@ -267,6 +273,7 @@ namespace AdaptiveCards
 
     enum class FontType
     {
+        // When a value is added after the last one, update the table sizes in CompiledHostConfig (HostConfig.h)
         Default = 0,
         Monospace
     };
@@ -274,6 +281,7 @@ namespace AdaptiveCards
 
     enum class ForegroundColor
     {
+        // When a value is added after the last one, update the table sizes in CompiledHostConfig (HostConfig.h)
         Default = 0,
         Dark,
         Light,
@@ -408,6 +416,7 @@ namespace AdaptiveCards
 
     enum class ContainerStyle
     {
+        // When a value is added after the last one, update the table sizes in CompiledHostConfig (HostConfig.h)
         None,
         Default,
         Emphasis,
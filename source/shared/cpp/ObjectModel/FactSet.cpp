@@ -65,5 +65,8 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
 
 void FactSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Facts});
+    SetKnownProperties(knownProperties);
 }
@@ -4,6 +4,7 @@
 
 #include "pch.h"
 #include "ParseUtil.h"
+#include "SemanticVersion.h"
 
 namespace AdaptiveCards
 {
@@ -14,23 +15,25 @@ namespace AdaptiveCards
         std::string ToLowercase(const std::string& value);
     }
 
+    // Feature names compare without regard to ASCII case. Both functors fold case as they go rather than building
+    // lowercase copies, so lookups don't allocate.
     struct CaseInsensitiveKeyHash
     {
-        size_t operator()(const std::string& keyVal) const
-        {
-            return std::hash<std::string>{}(ParseUtil::ToLowercase(keyVal));
-        }
+        using is_transparent = void;
+
+        size_t operator()(std::string_view keyVal) const noexcept { return CaseInsensitiveHash{}(keyVal); }
     };
 
     struct CaseInsensitiveKeyEquals
     {
-        bool operator()(const std::string& leftVal, const std::string& rightVal) const
+        using is_transparent = void;
+
+        bool operator()(std::string_view leftVal, std::string_view rightVal) const noexcept
         {
-            return (ParseUtil::ToLowercase(leftVal) == ParseUtil::ToLowercase(rightVal));
+            return CaseInsensitiveEqualTo{}(leftVal, rightVal);
         }
     };
 
-    class SemanticVersion;
     class FeatureRegistration
     {
     public:
@@ -39,9 +42,20 @@ namespace AdaptiveCards
         void AddFeature(const std::string& featureName, const std::string& featureVersion);
         void RemoveFeature(const std::string& featureName);
         SemanticVersion GetAdaptiveCardsVersion() const;
-        std::string GetFeatureVersion(const std::string& featureName) const;
+        // Returns the version the host registered for featureName, or an empty string if it didn't register it
+        const std::string& GetFeatureVersion(const std::string& featureName) const;
+
+        // Returns true if the host provides featureName at requiredVersion or later
+        bool SupportsFeatureVersion(const std::string& featureName, const SemanticVersion& requiredVersion) const;
 
     private:
-        std::unordered_map<std::string, std::string, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals> m_supportedFeatures;
+        struct FeatureVersion
+        {
+            std::string version;
+            // parsed form of version, empty for "*"
+            std::optional<SemanticVersion> parsedVersion;
+        };
+
+        std::unordered_map<std::string, FeatureVersion, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals> m_supportedFeatures;
     };
 }
@@ -150,6 +150,16 @@ HighlightColorConfig HighlightColorConfig::Deserialize(const Json::Value& json,
     return result;
 }
 
+std::uint32_t HighlightColorConfig::GetDefaultColorArgb() const
+{
+    return ParseUtil::TryParseColor(defaultColor).value_or(0);
+}
+
+std::uint32_t HighlightColorConfig::GetSubtleColorArgb() const
+{
+    return ParseUtil::TryParseColor(subtleColor).value_or(0);
+}
+
 ColorConfig ColorConfig::Deserialize(const Json::Value& json, const ColorConfig& defaultValue)
 {
     ColorConfig result;
@@ -165,6 +175,16 @@ ColorConfig ColorConfig::Deserialize(const Json::Value& json, const ColorConfig&
     return result;
 }
 
+std::uint32_t ColorConfig::GetDefaultColorArgb() const
+{
+    return ParseUtil::TryParseColor(defaultColor).value_or(0);
+}
+
+std::uint32_t ColorConfig::GetSubtleColorArgb() const
+{
+    return ParseUtil::TryParseColor(subtleColor).value_or(0);
+}
+
 ColorsConfig ColorsConfig::Deserialize(const Json::Value& json, const ColorsConfig& defaultValue)
 {
     ColorsConfig result;
@@ -208,12 +228,12 @@ ColorsConfig ColorsConfig::Deserialize(const Json::Value& json, const ColorsConf
 
 void TextStyleConfigDeserializeHelper(TextStyleConfig& result, const Json::Value& json, const TextStyleConfig& defaultValue)
 {
-    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorFromString);
+    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorTryFromString);
     result.fontType =
-        ParseUtil::GetEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, defaultValue.fontType, FontTypeFromString);
+        ParseUtil::GetEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, defaultValue.fontType, FontTypeTryFromString);
     result.isSubtle = ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsSubtle, defaultValue.isSubtle);
-    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeFromString);
-    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightFromString);
+    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeTryFromString);
+    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightTryFromString);
 }
 
 TextStyleConfig TextStyleConfig::Deserialize(const Json::Value& json, const TextStyleConfig& defaultValue)
@@ -271,7 +291,7 @@ ImageSetConfig ImageSetConfig::Deserialize(const Json::Value& json, const ImageS
 {
     ImageSetConfig result;
     result.imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::ImageSize, defaultValue.imageSize, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::ImageSize, defaultValue.imageSize, ImageSizeTryFromString);
 
     result.maxImageHeight = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxImageHeight, defaultValue.maxImageHeight);
 
@@ -303,9 +323,9 @@ ShowCardActionConfig ShowCardActionConfig::Deserialize(const Json::Value& json,
 {
     ShowCardActionConfig result;
     result.actionMode =
-        ParseUtil::GetEnumValue<ActionMode>(json, AdaptiveCardSchemaKey::ActionMode, defaultValue.actionMode, ActionModeFromString);
+        ParseUtil::GetEnumValue<ActionMode>(json, AdaptiveCardSchemaKey::ActionMode, defaultValue.actionMode, ActionModeTryFromString);
     result.inlineTopMargin = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::InlineTopMargin, defaultValue.inlineTopMargin);
-    result.style = ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, defaultValue.style, ContainerStyleFromString);
+    result.style = ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, defaultValue.style, ContainerStyleTryFromString);
 
     return result;
 }
@@ -317,10 +337,10 @@ ActionsConfig ActionsConfig::Deserialize(const Json::Value& json, const ActionsC
     result.actionsOrientation = ParseUtil::GetEnumValue<ActionsOrientation>(json,
                                                                             AdaptiveCardSchemaKey::ActionsOrientation,
                                                                             defaultValue.actionsOrientation,
-                                                                            ActionsOrientationFromString);
+                                                                            ActionsOrientationTryFromString);
 
     result.actionAlignment =
-        ParseUtil::GetEnumValue<ActionAlignment>(json, AdaptiveCardSchemaKey::ActionAlignment, defaultValue.actionAlignment, ActionAlignmentFromString);
+        ParseUtil::GetEnumValue<ActionAlignment>(json, AdaptiveCardSchemaKey::ActionAlignment, defaultValue.actionAlignment, ActionAlignmentTryFromString);
 
     result.buttonSpacing = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::ButtonSpacing, defaultValue.buttonSpacing);
 
@@ -329,10 +349,10 @@ ActionsConfig ActionsConfig::Deserialize(const Json::Value& json, const ActionsC
     result.showCard = ParseUtil::ExtractJsonValueAndMergeWithDefault<ShowCardActionConfig>(
         json, AdaptiveCardSchemaKey::ShowCard, defaultValue.showCard, ShowCardActionConfig::Deserialize);
 
-    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingFromString);
+    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingTryFromString);
 
     result.iconPlacement =
-        ParseUtil::GetEnumValue<IconPlacement>(json, AdaptiveCardSchemaKey::IconPlacement, defaultValue.iconPlacement, IconPlacementFromString);
+        ParseUtil::GetEnumValue<IconPlacement>(json, AdaptiveCardSchemaKey::IconPlacement, defaultValue.iconPlacement, IconPlacementTryFromString);
 
     result.iconSize = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::IconSize, defaultValue.iconSize);
 
@@ -343,15 +363,15 @@ InputLabelConfig InputLabelConfig::Deserialize(const Json::Value& json, const In
 {
     InputLabelConfig result;
 
-    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorFromString);
+    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorTryFromString);
 
     result.isSubtle = ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsSubtle, defaultValue.isSubtle);
 
-    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeFromString);
+    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeTryFromString);
 
     result.suffix = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Suffix, defaultValue.suffix);
 
-    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightFromString);
+    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightTryFromString);
 
     return result;
 }
@@ -361,7 +381,7 @@ LabelConfig LabelConfig::Deserialize(const Json::Value& json, const LabelConfig&
     LabelConfig result;
 
     result.inputSpacing =
-        ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::InputSpacing, defaultValue.inputSpacing, SpacingFromString);
+        ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::InputSpacing, defaultValue.inputSpacing, SpacingTryFromString);
 
     result.requiredInputs = ParseUtil::ExtractJsonValueAndMergeWithDefault<InputLabelConfig>(
         json, AdaptiveCardSchemaKey::RequiredInputs, defaultValue.requiredInputs, InputLabelConfig::Deserialize);
@@ -376,11 +396,11 @@ ErrorMessageConfig ErrorMessageConfig::Deserialize(const Json::Value& json, cons
 {
     ErrorMessageConfig result;
 
-    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeFromString);
+    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeTryFromString);
 
-    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingFromString);
+    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingTryFromString);
 
-    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightFromString);
+    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightTryFromString);
 
     return result;
 }
@@ -449,6 +469,16 @@ ContainerStyleDefinition ContainerStyleDefinition::Deserialize(const Json::Value
     return result;
 }
 
+std::uint32_t ContainerStyleDefinition::GetBackgroundColorArgb() const
+{
+    return ParseUtil::TryParseColor(backgroundColor).value_or(0);
+}
+
+std::uint32_t ContainerStyleDefinition::GetBorderColorArgb() const
+{
+    return ParseUtil::TryParseColor(borderColor).value_or(0);
+}
+
 ContainerStylesDefinition ContainerStylesDefinition::Deserialize(const Json::Value& json, const ContainerStylesDefinition& defaultValue)
 {
     ContainerStylesDefinition result;
@@ -492,7 +522,7 @@ ImageConfig ImageConfig::Deserialize(const Json::Value& json, const ImageConfig&
     ImageConfig result;
 
     result.imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.imageSize, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.imageSize, ImageSizeTryFromString);
 
     return result;
 }
@@ -532,6 +562,11 @@ TableConfig TableConfig::Deserialize(const Json::Value& json, const TableConfig&
 }
 
 FontTypeDefinition HostConfig::GetFontType(FontType type) const
+{
+    return GetFontTypeDefinition(type);
+}
+
+const FontTypeDefinition& HostConfig::GetFontTypeDefinition(FontType type) const
 {
     switch (type)
     {
@@ -642,7 +677,7 @@ unsigned int FontWeightsConfig::GetDefaultFontWeight(TextWeight weight)
 std::string HostConfig::GetFontFamily(FontType fontType) const
 {
     // desired font family
-    auto fontFamilyValue = GetFontType(fontType).fontFamily;
+    auto fontFamilyValue = GetFontTypeDefinition(fontType).fontFamily;
 
     if (fontFamilyValue.empty())
     {
@@ -668,7 +703,7 @@ std::string HostConfig::GetFontFamily(FontType fontType) const
 unsigned int HostConfig::GetFontSize(FontType fontType, TextSize size) const
 {
     // desired font size
-    auto result = GetFontType(fontType).fontSizes.GetFontSize(size);
+    auto result = GetFontTypeDefinition(fontType).fontSizes.GetFontSize(size);
 
     // std::numeric_limits<unsigned int>::max() used to check if value was defined
     if (result == std::numeric_limits<unsigned int>::max())
@@ -692,7 +727,7 @@ unsigned int HostConfig::GetFontSize(FontType fontType, TextSize size) const
 unsigned int HostConfig::GetFontWeight(FontType fontType, TextWeight weight) const
 {
     // desired font weight
-    auto result = GetFontType(fontType).fontWeights.GetFontWeight(weight);
+    auto result = GetFontTypeDefinition(fontType).fontWeights.GetFontWeight(weight);
 
     // std::numeric_limits<unsigned int>::max() used to check if value was defined
     if (result == std::numeric_limits<unsigned int>::max())
@@ -738,7 +773,7 @@ std::string HostConfig::GetBackgroundColor(ContainerStyle style) const
     return GetContainerStyle(style).backgroundColor;
 }
 
-template<typename T> std::string GetColorFromColorConfig(T colorConfig, bool isSubtle)
+template<typename T> std::string GetColorFromColorConfig(const T& colorConfig, bool isSubtle)
 {
     return (isSubtle) ? (colorConfig.subtleColor) : (colorConfig.defaultColor);
 }
@@ -767,13 +802,13 @@ const ColorConfig& HostConfig::GetContainerColorConfig(const ColorsConfig& color
 
 std::string HostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
 {
-    auto colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color);
+    const auto& colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color);
     return GetColorFromColorConfig(colorConfig, isSubtle);
 }
 
 std::string HostConfig::GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
 {
-    auto colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color).highlightColors;
+    const auto& colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color).highlightColors;
     return GetColorFromColorConfig(colorConfig, isSubtle);
 }
 
@@ -787,6 +822,26 @@ unsigned int HostConfig::GetBorderThickness(ContainerStyle style) const
     return GetContainerStyle(style).borderThickness;
 }
 
+const CompiledHostConfig& HostConfig::GetCompiled() const
+{
+    std::shared_ptr<const CompiledHostConfig> compiled = std::atomic_load(&_compiled);
+    if (!compiled)
+    {
+        // if another thread got there first, use its result so that references handed out stay valid
+        auto built = std::make_shared<const CompiledHostConfig>(*this);
+        if (std::atomic_compare_exchange_strong(&_compiled, &compiled, built))
+        {
+            compiled = std::move(built);
+        }
+    }
+    return *compiled;
+}
+
+void HostConfig::ResetCompiled()
+{
+    std::atomic_store(&_compiled, std::shared_ptr<const CompiledHostConfig>());
+}
+
 std::string HostConfig::GetFontFamily() const
 {
     return _fontFamily;
@@ -795,6 +850,7 @@ std::string HostConfig::GetFontFamily() const
 void HostConfig::SetFontFamily(const std::string& value)
 {
     _fontFamily = value;
+    ResetCompiled();
 }
 
 FontSizesConfig HostConfig::GetFontSizes() const
@@ -805,6 +861,7 @@ FontSizesConfig HostConfig::GetFontSizes() const
 void HostConfig::SetFontSizes(const FontSizesConfig value)
 {
     _fontSizes = value;
+    ResetCompiled();
 }
 
 FontWeightsConfig HostConfig::GetFontWeights() const
@@ -815,6 +872,7 @@ FontWeightsConfig HostConfig::GetFontWeights() const
 void HostConfig::SetFontWeights(const FontWeightsConfig value)
 {
     _fontWeights = value;
+    ResetCompiled();
 }
 
 FontTypesDefinition HostConfig::GetFontTypes() const
@@ -825,6 +883,7 @@ FontTypesDefinition HostConfig::GetFontTypes() const
 void HostConfig::SetFontTypes(const FontTypesDefinition value)
 {
     _fontTypes = value;
+    ResetCompiled();
 }
 
 bool HostConfig::GetSupportsInteractivity() const
@@ -935,6 +994,7 @@ ContainerStylesDefinition HostConfig::GetContainerStyles() const
 void HostConfig::SetContainerStyles(const ContainerStylesDefinition value)
 {
     _containerStyles = value;
+    ResetCompiled();
 }
 
 MediaConfig HostConfig::GetMedia() const
@@ -986,3 +1046,96 @@ void HostConfig::SetTable(const TableConfig value)
 {
     _table = value;
 }
+
+namespace
+{
+    // Index of an enum value into a table of `count` entries, falling back to `defaultValue` when out of range
+    template<typename T> size_t TableIndex(T value, size_t count, T defaultValue)
+    {
+        const auto index = static_cast<size_t>(value);
+        return index < count ? index : static_cast<size_t>(defaultValue);
+    }
+
+    std::uint32_t CompileColor(const std::string& color) { return ParseUtil::TryParseColor(color).value_or(0); }
+}
+
+CompiledHostConfig::CompiledHostConfig(const HostConfig& hostConfig)
+{
+    for (size_t fontType = 0; fontType < c_fontTypeCount; ++fontType)
+    {
+        const auto type = static_cast<FontType>(fontType);
+        _fontFamilies[fontType] = hostConfig.GetFontFamily(type);
+        for (size_t size = 0; size < c_textSizeCount; ++size)
+        {
+            _fontSizes[fontType][size] = hostConfig.GetFontSize(type, static_cast<TextSize>(size));
+        }
+        for (size_t weight = 0; weight < c_textWeightCount; ++weight)
+        {
+            _fontWeights[fontType][weight] = hostConfig.GetFontWeight(type, static_cast<TextWeight>(weight));
+        }
+    }
+
+    for (size_t containerStyle = 0; containerStyle < c_containerStyleCount; ++containerStyle)
+    {
+        const auto style = static_cast<ContainerStyle>(containerStyle);
+        auto& colors = _containerStyles[containerStyle];
+        colors.backgroundColor = CompileColor(hostConfig.GetBackgroundColor(style));
+        colors.borderColor = CompileColor(hostConfig.GetBorderColor(style));
+        colors.borderThickness = hostConfig.GetBorderThickness(style);
+        for (size_t color = 0; color < c_foregroundColorCount; ++color)
+        {
+            for (const bool isSubtle : {false, true})
+            {
+                colors.foregroundColors[color][isSubtle] =
+                    CompileColor(hostConfig.GetForegroundColor(style, static_cast<ForegroundColor>(color), isSubtle));
+                colors.highlightColors[color][isSubtle] =
+                    CompileColor(hostConfig.GetHighlightColor(style, static_cast<ForegroundColor>(color), isSubtle));
+            }
+        }
+    }
+}
+
+const std::string& CompiledHostConfig::GetFontFamily(FontType fontType) const
+{
+    return _fontFamilies[TableIndex(fontType, c_fontTypeCount, FontType::Default)];
+}
+
+unsigned int CompiledHostConfig::GetFontSize(FontType fontType, TextSize size) const
+{
+    return _fontSizes[TableIndex(fontType, c_fontTypeCount, FontType::Default)][TableIndex(size, c_textSizeCount, TextSize::Default)];
+}
+
+unsigned int CompiledHostConfig::GetFontWeight(FontType fontType, TextWeight weight) const
+{
+    return _fontWeights[TableIndex(fontType, c_fontTypeCount, FontType::Default)][TableIndex(weight, c_textWeightCount, TextWeight::Default)];
+}
+
+const CompiledHostConfig::ContainerStyleColors& CompiledHostConfig::GetContainerStyleColors(ContainerStyle style) const
+{
+    return _containerStyles[TableIndex(style, c_containerStyleCount, ContainerStyle::Default)];
+}
+
+std::uint32_t CompiledHostConfig::GetBackgroundColor(ContainerStyle style) const
+{
+    return GetContainerStyleColors(style).backgroundColor;
+}
+
+std::uint32_t CompiledHostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return GetContainerStyleColors(style).foregroundColors[TableIndex(color, c_foregroundColorCount, ForegroundColor::Default)][isSubtle];
+}
+
+std::uint32_t CompiledHostConfig::GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return GetContainerStyleColors(style).highlightColors[TableIndex(color, c_foregroundColorCount, ForegroundColor::Default)][isSubtle];
+}
+
+std::uint32_t CompiledHostConfig::GetBorderColor(ContainerStyle style) const
+{
+    return GetContainerStyleColors(style).borderColor;
+}
+
+unsigned int CompiledHostConfig::GetBorderThickness(ContainerStyle style) const
+{
+    return GetContainerStyleColors(style).borderThickness;
+}
@@ -4,6 +4,8 @@
 
 #include "pch.h"
 
+#include <array>
+
 namespace AdaptiveCards
 {
     class FontSizesConfig
@@ -71,6 +73,10 @@ namespace AdaptiveCards
         std::string defaultColor;
         std::string subtleColor;
 
+        // Packed 0xAARRGGBB forms of the colors above (0 if a color isn't in #AARRGGBB or #RRGGBB form)
+        std::uint32_t GetDefaultColorArgb() const;
+        std::uint32_t GetSubtleColorArgb() const;
+
         static HighlightColorConfig Deserialize(const Json::Value& json, const HighlightColorConfig& defaultValue);
     };
 
@@ -81,6 +87,10 @@ namespace AdaptiveCards
 
         HighlightColorConfig highlightColors;
 
+        // Packed 0xAARRGGBB forms of the colors above (0 if a color isn't in #AARRGGBB or #RRGGBB form)
+        std::uint32_t GetDefaultColorArgb() const;
+        std::uint32_t GetSubtleColorArgb() const;
+
         static ColorConfig Deserialize(const Json::Value& json, const ColorConfig& defaultValue);
     };
 
@@ -200,6 +210,10 @@ namespace AdaptiveCards
                                           // (see #1150)
         ColorsConfig foregroundColors;
 
+        // Packed 0xAARRGGBB forms of the colors above (0 if a color isn't in #AARRGGBB or #RRGGBB form)
+        std::uint32_t GetBackgroundColorArgb() const;
+        std::uint32_t GetBorderColorArgb() const;
+
         static ContainerStyleDefinition Deserialize(const Json::Value& json, const ContainerStyleDefinition& defaultValue);
     };
 
@@ -371,6 +385,58 @@ namespace AdaptiveCards
         static TableConfig Deserialize(const Json::Value& json, const TableConfig& defaultValue);
     };
 
+    class HostConfig;
+
+    // The renderer-facing HostConfig lookups, resolved once. Font families, sizes and weights have their fallbacks
+    // (default font type, deprecated top-level values, built-in defaults) already applied, and container colors are
+    // parsed to packed 0xAARRGGBB (0 where the configured string isn't a valid color). Every accessor is an array
+    // lookup; values outside an enum's range resolve like its Default value, as in HostConfig.
+    class CompiledHostConfig
+    {
+    public:
+        CompiledHostConfig() = default;
+        explicit CompiledHostConfig(const HostConfig& hostConfig);
+
+        const std::string& GetFontFamily(FontType fontType) const;
+        unsigned int GetFontSize(FontType fontType, TextSize size) const;
+        unsigned int GetFontWeight(FontType fontType, TextWeight weight) const;
+
+        std::uint32_t GetBackgroundColor(ContainerStyle style) const;
+        std::uint32_t GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+        std::uint32_t GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+        std::uint32_t GetBorderColor(ContainerStyle style) const;
+        unsigned int GetBorderThickness(ContainerStyle style) const;
+
+    private:
+        static constexpr size_t c_fontTypeCount = 2;
+        static constexpr size_t c_textSizeCount = 5;
+        static constexpr size_t c_textWeightCount = 3;
+        static constexpr size_t c_foregroundColorCount = 7;
+        static constexpr size_t c_containerStyleCount = 7;
+        static_assert(c_fontTypeCount == static_cast<size_t>(FontType::Monospace) + 1, "c_fontTypeCount must match FontType");
+        static_assert(c_textSizeCount == static_cast<size_t>(TextSize::ExtraLarge) + 1, "c_textSizeCount must match TextSize");
+        static_assert(c_textWeightCount == static_cast<size_t>(TextWeight::Bolder) + 1, "c_textWeightCount must match TextWeight");
+        static_assert(c_foregroundColorCount == static_cast<size_t>(ForegroundColor::Attention) + 1, "c_foregroundColorCount must match ForegroundColor");
+        static_assert(c_containerStyleCount == static_cast<size_t>(ContainerStyle::Accent) + 1, "c_containerStyleCount must match ContainerStyle");
+
+        struct ContainerStyleColors
+        {
+            std::uint32_t backgroundColor = 0;
+            std::uint32_t borderColor = 0;
+            unsigned int borderThickness = 0;
+            // indexed by ForegroundColor, then by isSubtle
+            std::array<std::array<std::uint32_t, 2>, c_foregroundColorCount> foregroundColors{};
+            std::array<std::array<std::uint32_t, 2>, c_foregroundColorCount> highlightColors{};
+        };
+
+        const ContainerStyleColors& GetContainerStyleColors(ContainerStyle style) const;
+
+        std::array<std::string, c_fontTypeCount> _fontFamilies;
+        std::array<std::array<unsigned int, c_textSizeCount>, c_fontTypeCount> _fontSizes{};
+        std::array<std::array<unsigned int, c_textWeightCount>, c_fontTypeCount> _fontWeights{};
+        std::array<ContainerStyleColors, c_containerStyleCount> _containerStyles{};
+    };
+
     class HostConfig
     {
     public:
@@ -389,6 +455,10 @@ namespace AdaptiveCards
         std::string GetBorderColor(ContainerStyle style) const;
         unsigned int GetBorderThickness(ContainerStyle style) const;
 
+        // The lookups above, resolved ahead of time. Built on first use and again after a setter that affects it; the
+        // returned reference is invalidated by those setters.
+        const CompiledHostConfig& GetCompiled() const;
+
         std::string GetFontFamily() const;
         void SetFontFamily(const std::string& value);
 
@@ -450,8 +520,10 @@ namespace AdaptiveCards
         void SetTable(const TableConfig value);
 
     private:
+        const FontTypeDefinition& GetFontTypeDefinition(FontType fontType) const;
         const ContainerStyleDefinition& GetContainerStyle(ContainerStyle style) const;
         const ColorConfig& GetContainerColorConfig(const ColorsConfig& colors, ForegroundColor color) const;
+        void ResetCompiled();
 
         std::string _fontFamily;
         FontSizesConfig _fontSizes;
@@ -473,5 +545,8 @@ namespace AdaptiveCards
         TextBlockConfig _textBlock;
         TextStylesConfig _textStyles;
         TableConfig _table;
+        // Set at most once between changes to the config, by whichever thread gets there first; accessed through
+        // std::atomic_load/atomic_compare_exchange_strong since renderers may share a host config across threads
+        mutable std::shared_ptr<const CompiledHostConfig> _compiled;
     };
 }
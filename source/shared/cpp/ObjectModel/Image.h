@@ -26,6 +26,8 @@ namespace AdaptiveCards
 
         std::string GetBackgroundColor() const;
         void SetBackgroundColor(const std::string& value);
+        // Background color as packed 0xAARRGGBB, or nullopt if there isn't one in #AARRGGBB or #RRGGBB form
+        std::optional<std::uint32_t> GetBackgroundColorArgb() const;
 
         ImageStyle GetImageStyle() const;
         void SetImageStyle(const ImageStyle value);
@@ -55,6 +57,7 @@ namespace AdaptiveCards
 
         std::string m_url;
         std::string m_backgroundColor;
+        std::optional<std::uint32_t> m_backgroundColorArgb;
         ImageStyle m_imageStyle;
         ImageSize m_imageSize;
         unsigned int m_pixelWidth;
@@ -59,7 +59,7 @@ std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& conte
     auto imageSet = BaseCardElement::Deserialize<ImageSet>(context, value);
     // Get ImageSize
     imageSet->m_imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeTryFromString);
 
     // Parse Images
     auto images = ParseUtil::GetElementCollection<Image>(
@@ -80,8 +80,11 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
 
 void ImageSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Images,
+                                          AdaptiveCardSchemaKey::ImageSize});
+    SetKnownProperties(knownProperties);
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -6,7 +6,12 @@
 
 using namespace AdaptiveCards;
 
-Inline::Inline(InlineElementType type) : m_type(type)
+Inline::Inline() : m_knownProperties{}
+{
+    PopulateKnownPropertiesSet();
+}
+
+Inline::Inline(InlineElementType type) : m_knownProperties{}, m_type(type)
 {
     PopulateKnownPropertiesSet();
 }
@@ -53,5 +58,8 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
 
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties({},
+                                         {AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
 }
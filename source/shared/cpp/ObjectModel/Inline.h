@@ -13,7 +13,7 @@ namespace AdaptiveCards
     {
     public:
         Inline(InlineElementType type);
-        Inline() = default;
+        Inline();
         Inline(const Inline&) = default;
         Inline(Inline&&) = default;
         Inline& operator=(const Inline&) = default;
@@ -31,14 +31,19 @@ namespace AdaptiveCards
         const Json::Value& GetAdditionalProperties() const;
         void SetAdditionalProperties(Json::Value&& additionalProperties);
         void SetAdditionalProperties(const Json::Value& additionalProperties);
+        const std::unordered_set<std::string>& GetKnownProperties() const { return *m_knownProperties; }
 
     protected:
-        std::unordered_set<std::string> m_knownProperties;
+        // Points this inline at the property names its type understands, a set built once per type that must outlive
+        // its instances; see BaseElement::SetKnownProperties
+        void SetKnownProperties(const std::unordered_set<std::string>& knownProperties) { m_knownProperties = &knownProperties; }
+
         Json::Value m_additionalProperties;
 
     private:
         void PopulateKnownPropertiesSet();
 
+        const std::unordered_set<std::string>* m_knownProperties;
         InlineElementType m_type;
     };
 }
@@ -7,7 +7,8 @@
 namespace AdaptiveCards
 {
     // Used to uniquely identify a single BaseElement-derived object through the course of deserializing. For more
-    // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
+    // details, refer to the giant comment on ID collision detection in ParseContext.cpp. Next() may be called from
+    // any number of threads at once; Current() returns the last id Next() handed out on the calling thread.
     class InternalId
     {
     public:
@@ -25,7 +26,6 @@ namespace AdaptiveCards
         bool operator!=(const InternalId& other) const { return m_internalId != other.m_internalId; }
 
     private:
-        static unsigned int s_currentInternalId;
         InternalId(const unsigned int id);
         unsigned int m_internalId;
     };
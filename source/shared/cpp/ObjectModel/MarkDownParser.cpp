@@ -1,13 +1,1972 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
-#include <vector>
-#include <iomanip>
-#include <iostream>
+#include <array>
 #include "MarkDownParser.h"
 
 using namespace AdaptiveCards;
 
+namespace
+{
+    // Bits of c_charClasses. Space, Punct, Alnum, Cntrl and Digit are what isspace, ispunct... give in the "C" locale,
+    // except that bytes above 0x7F are alphanumeric (they are part of a UTF-8 encoded character). Special bytes end a
+    // run of plain text, Entity bytes are written to html as character entities.
+    enum CharClass : std::uint8_t
+    {
+        Space = 0x01,
+        Punct = 0x02,
+        Alnum = 0x04,
+        Cntrl = 0x08,
+        Digit = 0x10,
+        Special = 0x20,
+        Entity = 0x40
+    };
+
+    constexpr std::array<std::uint8_t, 256> MakeCharClassTable()
+    {
+        std::array<std::uint8_t, 256> table{};
+        for (int ch = 1; ch < 256; ++ch)
+        {
+            std::uint8_t charClass = 0;
+            if (ch == ' ' || (ch >= '\t' && ch <= '\r'))
+            {
+                charClass |= Space;
+            }
+            if ((ch >= '!' && ch <= '/') || (ch >= ':' && ch <= '@') || (ch >= '[' && ch <= '`') || (ch >= '{' && ch <= '~'))
+            {
+                charClass |= Punct;
+            }
+            if ((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch > 0x7F)
+            {
+                charClass |= Alnum;
+            }
+            if (ch < ' ' || ch == 0x7F)
+            {
+                charClass |= Cntrl;
+            }
+            if (ch >= '0' && ch <= '9')
+            {
+                charClass |= Digit;
+            }
+            table[ch] = charClass;
+        }
+        for (const char ch : {'*', '_', '[', ']', ')', '\n', '\r', '\\'})
+        {
+            table[static_cast<unsigned char>(ch)] |= Special;
+        }
+        for (const char ch : {'<', '>', '"', '&'})
+        {
+            table[static_cast<unsigned char>(ch)] |= Entity;
+        }
+        return table;
+    }
+
+    constexpr std::array<std::uint8_t, 256> c_charClasses = MakeCharClassTable();
+
+    // ch is a byte or EOF, as returned by MarkDownTokenizer::Peek
+    constexpr bool IsCharClass(const int ch, const std::uint8_t charClass)
+    {
+        return ch >= 0 && (c_charClasses[ch] & charClass);
+    }
+
+    constexpr bool IsNewLine(const int ch)
+    {
+        return ch == '\r' || ch == '\n';
+    }
+
+    // Characters that end text and emphasis parsing to be handled by ParseBlock
+    constexpr bool IsKeyword(const int ch)
+    {
+        return ch == '[' || ch == ']' || ch == ')' || IsNewLine(ch);
+    }
+
+    constexpr bool IsListMarker(const int ch)
+    {
+        return ch == '-' || ch == '+' || ch == '*';
+    }
+
+    enum class MarkDownTokenType : std::uint8_t
+    {
+        Text,
+        NewLine,
+        LeftEmphasis,
+        RightEmphasis,
+        LeftAndRightEmphasis,
+        Link,
+        ListItem,
+        OrderedListItem
+    };
+
+    constexpr MarkDownBlockType GetBlockType(const MarkDownTokenType type)
+    {
+        return (type == MarkDownTokenType::ListItem) ?
+            MarkDownBlockType::BulletedListItem :
+            ((type == MarkDownTokenType::OrderedListItem) ? MarkDownBlockType::NumberedListItem : MarkDownBlockType::Paragraph);
+    }
+
+    enum class EmphasisTag : std::uint8_t
+    {
+        OpeningItalic,
+        ClosingItalic,
+        OpeningBold,
+        ClosingBold
+    };
+
+    constexpr int c_noToken = -1;
+
+    // An entry of the token arena, in place of a MarkDownHtmlGenerator. Its text is escaped html in the tokenizer's
+    // text arena, and comes from one range of the text being parsed. previous and next thread it through the token list
+    // it belongs to, nextEmphasis through the emphasis lookup table, and firstTag through the emphasis tags it's been
+    // given. A link or list item has no text of its own but the list of tokens it was captured from.
+    struct MarkDownToken
+    {
+        MarkDownTokenType type;
+        bool isHead;
+        bool isTail;
+        // where a left and right emphasis ended up
+        bool isLeftDirection;
+        DelimiterType delimiterType;
+        int unusedDelimiters;
+        std::size_t textOffset;
+        std::size_t textLength;
+        // in the text being parsed
+        std::size_t sourceOffset;
+        std::size_t sourceLength;
+        // the start of an ordered list, in the text being parsed
+        std::size_t numberOffset;
+        std::size_t numberLength;
+        int previous;
+        int next;
+        int nextEmphasis;
+        int firstTag;
+        int lastTag;
+        // the link text or the content of a list item
+        int firstChild;
+        int destination;
+    };
+
+    struct MarkDownTag
+    {
+        EmphasisTag tag;
+        int next;
+    };
+
+    // The tokens and emphasis lookup table collected by one parser, as in MarkDownParsedResult
+    struct MarkDownTokenList
+    {
+        int front = c_noToken;
+        int back = c_noToken;
+        int emphasisFront = c_noToken;
+        int emphasisBack = c_noToken;
+        bool hasHtmlTags = false;
+        bool isCaptured = false;
+    };
+
+    // State of an EmphasisParser
+    struct EmphasisParserState
+    {
+        bool checkLookAhead = false;
+        bool checkIntraWord = false;
+        DelimiterType lookBehind = DelimiterType::Init;
+        int delimiterCount = 0;
+        DelimiterType delimiterType = DelimiterType::Init;
+        // the token being collected runs from here to the end of the text arena, and from sourceOffset in the text
+        std::size_t tokenOffset = 0;
+        std::size_t sourceOffset = 0;
+    };
+
+    // The block TransformToRuns is adding runs to. It carries on through links and list items, as list items nested in
+    // them are added as list items of their own.
+    struct MarkDownRunBlock
+    {
+        MarkDownBlockType blockType = MarkDownBlockType::Paragraph;
+        bool isBlockStart = false;
+        std::size_t listStartOffset = 0;
+        std::size_t listStartLength = 0;
+        int listItemDepth = 0;
+    };
+
+    // The style of the runs within a list of tokens
+    struct MarkDownRunStyle
+    {
+        int boldTags = 0;
+        int italicTags = 0;
+        bool isLink = false;
+        std::string link;
+    };
+
+    // The links and block tags of a token, which appending to the list it ends may change
+    struct MarkDownTokenLinks
+    {
+        int token;
+        bool isHead;
+        bool isTail;
+        int previous;
+        int next;
+        int nextEmphasis;
+    };
+
+    // Where parsing carries on from when text is appended: after a top-level block, or partway through a top-level run
+    // of text, that was parsed without reading to the end of the text, so that the text appended can't change it
+    struct MarkDownParseCheckpoint
+    {
+        std::size_t position = 0;
+        std::size_t arenaSize = 0;
+        std::size_t tokenCount = 0;
+        std::size_t tagCount = 0;
+        MarkDownTokenList blocks;
+        // the run of text being parsed, if any
+        bool isInText = false;
+        MarkDownTokenList textTokens;
+        EmphasisParserState state;
+        // the last top-level emphasis token, and the first token whose html may still change
+        int lastEmphasis = c_noToken;
+        int firstChangeable = 0;
+        std::vector<MarkDownTokenLinks> changeable;
+    };
+
+    // A left emphasis MatchLeftAndRightEmphasises has yet to match, as it was at the checkpoint
+    struct MarkDownLeftEmphasis
+    {
+        int token;
+        int unusedDelimiters;
+        bool isLeftDirection;
+        int firstTag;
+        int lastTag;
+    };
+
+    // The state of MatchLeftAndRightEmphasises over the top-level tokens once it's done with those before the parse
+    // checkpoint. Of these, only the left emphasis it has yet to match can still change.
+    struct MarkDownMatchCheckpoint
+    {
+        int lastEmphasis = c_noToken;
+        std::size_t tagCount = 0;
+        bool hasHtmlTags = false;
+        std::vector<MarkDownLeftEmphasis> leftEmphasisToExplore;
+    };
+
+    // The html written for good: that of the top-level tokens up to lastToken, and the start of the one after it when
+    // that's the text a checkpoint in a run of text was partway through
+    struct MarkDownFinalHtml
+    {
+        int lastToken = c_noToken;
+        std::size_t size = 0;
+        std::size_t partialSize = 0;
+    };
+
+    // A top-level '[' parsed on past as text, as MatchLink leaves it when no ']' ends its link text, and the state to
+    // go back to if the text appended has that ']' after all
+    struct MarkDownLinkCheckpoint
+    {
+        MarkDownParseCheckpoint parse;
+        MarkDownMatchCheckpoint match;
+        MarkDownFinalHtml finalHtml;
+    };
+
+    constexpr std::string_view c_paragraphHead = "<p>";
+}
+
+namespace AdaptiveCards
+{
+    // Parses markdown following the rules of EmphasisParser, LinkParser, ListParser and OrderedListParser, and
+    // generates the same html byte for byte. The text is read from a string_view through Peek, Get and Unget, which
+    // keep a stream's eof and fail states since the parsers' behavior at the end of the text depends on them. Tokens
+    // live in one vector and their html in one string, and are linked into lists by index instead of being allocated
+    // one by one and spliced between std::lists. For an IncrementalMarkDownParser, the tokenizer is kept between
+    // calls and parses on from a checkpoint.
+    class MarkDownTokenizer
+    {
+    public:
+        explicit MarkDownTokenizer(std::string_view text);
+
+        // Appends the html to the given string, and returns whether any html tags were generated
+        bool TransformToHtml(std::string& html);
+
+        // Appends the runs to the given vector, and returns whether any html tags would be generated
+        bool TransformToRuns(std::vector<MarkDownRun>& runs);
+
+        // Parses the given text, which is the text parsed before with text appended, and rewrites the html written
+        // before from the first token that may have changed, whose start unchangedSize is set to. Returns whether any
+        // html tags were generated.
+        bool TransformAppendedToHtml(std::string_view text, std::string& html, std::size_t& unchangedSize);
+
+    private:
+        MarkDownTokenList Parse();
+        MarkDownTokenList ParseAppended();
+        void ParseFromCheckpoint(MarkDownTokenList& blocks);
+        void SaveCheckpoint(const MarkDownTokenList& blocks, const MarkDownTokenList* textTokens, const EmphasisParserState* state);
+        void AddChangeable(int token);
+        void RestoreCheckpoint(MarkDownTokenList& blocks);
+        bool MatchAppendedEmphasises(const MarkDownTokenList& blocks);
+        bool SaveMatchCheckpoints(int currentEmphasis, const std::vector<MarkDownTag>& tags, bool hasHtmlTags);
+        void SaveMatchCheckpoint(const MarkDownParseCheckpoint& parseCheckpoint, MarkDownMatchCheckpoint& checkpoint, const std::vector<MarkDownTag>& tags, bool hasHtmlTags);
+
+        int Peek();
+        int Get();
+        void Unget();
+
+        void AppendEscaped(char ch);
+        void AppendEscaped(std::string_view text);
+
+        int AddToken(MarkDownTokenType type, std::size_t textOffset, std::size_t sourceOffset, std::size_t sourceLength);
+        void AddCharToken(MarkDownTokenList& tokens, int ch);
+        void AddCharToken(MarkDownTokenList& tokens, int ch, std::size_t sourceOffset);
+        void AddNewLineToken(MarkDownTokenList& tokens, int ch);
+        void AppendToTokens(MarkDownTokenList& tokens, int token);
+        void AppendToLookUpTable(MarkDownTokenList& tokens, int token);
+        void AppendTokenList(MarkDownTokenList& tokens, MarkDownTokenList& other);
+        void MarkTags(MarkDownTokenList& tokens, int token);
+        void PopFront(MarkDownTokenList& tokens);
+        void PopBack(MarkDownTokenList& tokens);
+        static void Clear(MarkDownTokenList& tokens);
+
+        bool IsLeftEmphasis(int token) const;
+        bool IsRightEmphasis(int token) const;
+        bool IsMatch(int leftToken, int rightToken) const;
+        void PushTag(int token, bool isBold, std::vector<MarkDownTag>& tags);
+        bool GenerateTags(int leftToken, int rightToken, std::vector<MarkDownTag>& tags);
+        void MatchLeftAndRightEmphasises(MarkDownTokenList& tokens, std::vector<MarkDownTag>& tags);
+        void MatchEmphasises(int currentEmphasis, std::vector<MarkDownTag>& tags, bool& hasHtmlTags, bool isSavingCheckpoint);
+        void WriteHtml(int front, const std::vector<MarkDownTag>& tags, std::string& html) const;
+        void WriteHtml(const MarkDownToken& token, const std::vector<MarkDownTag>& tags, std::string& html) const;
+        void WriteHtml(const MarkDownToken& token, const std::vector<MarkDownTag>& tags, std::size_t writtenSize, std::string& html) const;
+        void AppendRuns(int front, const std::vector<MarkDownTag>& tags, MarkDownRunStyle style, MarkDownRunBlock& block, std::vector<MarkDownRun>& runs) const;
+        void AppendPlainText(int front, std::string& text) const;
+        static void StartBlock(MarkDownBlockType blockType, MarkDownRunBlock& block, std::vector<MarkDownRun>& runs);
+        static void EndBlock(MarkDownRunBlock& block, std::vector<MarkDownRun>& runs);
+        static void AddRun(std::size_t offset, std::size_t length, const MarkDownRunStyle& style, MarkDownRunBlock& block, std::vector<MarkDownRun>& runs);
+
+        void ParseBlock(MarkDownTokenList& tokens);
+        void ParseTextAndEmphasis(MarkDownTokenList& tokens);
+        void ParseTextAndEmphasis(MarkDownTokenList& tokens, MarkDownTokenList& emphasisTokens, EmphasisParserState& state);
+        void ScanPlainText(EmphasisParserState& state);
+        static void UpdateLookBehind(EmphasisParserState& state, int ch);
+        static void UpdateCurrentEmphasisRunState(EmphasisParserState& state, DelimiterType emphasisType);
+        static bool IsLeftEmphasisDelimiter(const EmphasisParserState& state, int ch);
+        static bool IsRightEmphasisDelimiter(const EmphasisParserState& state, int ch);
+        void CaptureText(MarkDownTokenList& tokens, EmphasisParserState& state, std::size_t sourceEnd);
+        void CaptureEmphasis(MarkDownTokenList& tokens, EmphasisParserState& state, int ch);
+
+        void MatchLink(MarkDownTokenList& tokens);
+        void CaptureLink(MarkDownTokenList& tokens, MarkDownTokenList& linkText);
+
+        void MatchList(MarkDownTokenList& tokens);
+        void MatchOrderedList(MarkDownTokenList& tokens);
+        bool CompleteListParsing(MarkDownTokenList& tokens);
+        void ParseSubBlocks(MarkDownTokenList& tokens);
+        bool MatchNewListItem();
+        bool MatchNewBlock();
+        bool MatchNewOrderedListItem();
+        void CaptureListItem(MarkDownTokenList& tokens, MarkDownTokenType type, std::size_t numberOffset, std::size_t numberLength);
+
+        std::string_view m_text;
+        std::size_t m_position;
+        bool m_eof;
+        bool m_fail;
+        // whether the end of the text has been read since the last checkpoint
+        bool m_hasReadToEnd;
+
+        std::string m_arena;
+        std::vector<MarkDownToken> m_tokens;
+        // the tags of link text and list items, and those of the top-level tokens, which are matched last
+        std::vector<MarkDownTag> m_tags;
+        std::vector<MarkDownTag> m_topLevelTags;
+        std::vector<int> m_leftEmphasisToExplore;
+        std::vector<int> m_unmatchedLeftEmphasis;
+
+        // the top-level list when parsing on from a checkpoint, as runs of text in it save checkpoints too
+        const MarkDownTokenList* m_checkpointBlocks;
+        MarkDownParseCheckpoint m_parseCheckpoint;
+        MarkDownMatchCheckpoint m_matchCheckpoint;
+        MarkDownFinalHtml m_finalHtml;
+        // the top-level '[' parsed on past as text, innermost last, from m_linkMatchIndex on without their match
+        // checkpoint yet. A top-level ']' after them ends the link text of the last one, which is then parsed again
+        // from m_endedLinkPosition with MatchLink.
+        std::vector<MarkDownLinkCheckpoint> m_linkCheckpoints;
+        std::size_t m_linkMatchIndex;
+        std::size_t m_endedLinkPosition;
+        bool m_isLinkTextEnded;
+    };
+
+    MarkDownTokenizer::MarkDownTokenizer(std::string_view text) :
+        m_text(text), m_position(0), m_eof(false), m_fail(false), m_hasReadToEnd(false), m_checkpointBlocks(nullptr),
+        m_linkMatchIndex(0), m_endedLinkPosition(std::string_view::npos), m_isLinkTextEnded(false)
+    {
+        m_arena.reserve(text.size() + text.size() / 4 + 16);
+        m_tokens.reserve(text.size() / 8 + 4);
+    }
+
+    // Peek, Get and Unget behave as they do on a std::istream: reading at the end sets eof, and any read once eof is
+    // set (or a Get at the end) sets fail, after which they return EOF. Unget clears eof first.
+    int MarkDownTokenizer::Peek()
+    {
+        if (m_eof || m_fail)
+        {
+            m_fail = true;
+            return EOF;
+        }
+        if (m_position == m_text.size())
+        {
+            m_eof = true;
+            m_hasReadToEnd = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_text[m_position]);
+    }
+
+    int MarkDownTokenizer::Get()
+    {
+        if (m_eof || m_fail)
+        {
+            m_fail = true;
+            return EOF;
+        }
+        if (m_position == m_text.size())
+        {
+            m_eof = true;
+            m_fail = true;
+            m_hasReadToEnd = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_text[m_position++]);
+    }
+
+    void MarkDownTokenizer::Unget()
+    {
+        m_eof = false;
+        if (m_fail || m_position == 0)
+        {
+            m_fail = true;
+            return;
+        }
+        --m_position;
+    }
+
+    void MarkDownTokenizer::AppendEscaped(char ch)
+    {
+        switch (ch)
+        {
+        case '<':
+            m_arena += "&lt;";
+            break;
+        case '>':
+            m_arena += "&gt;";
+            break;
+        case '"':
+            m_arena += "&quot;";
+            break;
+        case '&':
+            m_arena += "&amp;";
+            break;
+        default:
+            m_arena += ch;
+            break;
+        }
+    }
+
+    void MarkDownTokenizer::AppendEscaped(std::string_view text)
+    {
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            if (c_charClasses[static_cast<unsigned char>(text[i])] & Entity)
+            {
+                m_arena.append(text.data() + start, i - start);
+                AppendEscaped(text[i]);
+                start = i + 1;
+            }
+        }
+        m_arena.append(text.data() + start, text.size() - start);
+    }
+
+    // Adds a token whose text runs from textOffset to the end of the text arena
+    int MarkDownTokenizer::AddToken(MarkDownTokenType type, std::size_t textOffset, std::size_t sourceOffset, std::size_t sourceLength)
+    {
+        m_tokens.push_back({type, false, false, false, DelimiterType::Init, 0, textOffset, m_arena.size() - textOffset,
+                            sourceOffset, sourceLength, 0, 0, c_noToken, c_noToken, c_noToken, c_noToken, c_noToken,
+                            c_noToken, c_noToken});
+        return static_cast<int>(m_tokens.size() - 1);
+    }
+
+    // ch is the char just read
+    void MarkDownTokenizer::AddCharToken(MarkDownTokenList& tokens, int ch)
+    {
+        AddCharToken(tokens, ch, m_position - 1);
+    }
+
+    void MarkDownTokenizer::AddCharToken(MarkDownTokenList& tokens, int ch, std::size_t sourceOffset)
+    {
+        const std::size_t textOffset = m_arena.size();
+        AppendEscaped(static_cast<char>(ch));
+        AppendToTokens(tokens, AddToken(MarkDownTokenType::Text, textOffset, sourceOffset, 1));
+    }
+
+    void MarkDownTokenizer::AddNewLineToken(MarkDownTokenList& tokens, int ch)
+    {
+        const std::size_t textOffset = m_arena.size();
+        m_arena += static_cast<char>(ch);
+        AppendToTokens(tokens, AddToken(MarkDownTokenType::NewLine, textOffset, m_position - 1, 1));
+    }
+
+    void MarkDownTokenizer::AppendToTokens(MarkDownTokenList& tokens, int token)
+    {
+        if (tokens.back != c_noToken)
+        {
+            MarkTags(tokens, token);
+        }
+
+        m_tokens[token].previous = tokens.back;
+        m_tokens[token].next = c_noToken;
+        if (tokens.back == c_noToken)
+        {
+            tokens.front = token;
+        }
+        else
+        {
+            m_tokens[tokens.back].next = token;
+        }
+        tokens.back = token;
+    }
+
+    void MarkDownTokenizer::AppendToLookUpTable(MarkDownTokenList& tokens, int token)
+    {
+        m_tokens[token].nextEmphasis = c_noToken;
+        if (tokens.emphasisBack == c_noToken)
+        {
+            tokens.emphasisFront = token;
+        }
+        else
+        {
+            m_tokens[tokens.emphasisBack].nextEmphasis = token;
+        }
+        tokens.emphasisBack = token;
+    }
+
+    // Moves the other list's tokens and lookup table to the end of this one, as MarkDownParsedResult::AppendParseResult
+    void MarkDownTokenizer::AppendTokenList(MarkDownTokenList& tokens, MarkDownTokenList& other)
+    {
+        if (tokens.back != c_noToken && other.front != c_noToken)
+        {
+            MarkTags(tokens, other.front);
+        }
+
+        if (other.front != c_noToken)
+        {
+            m_tokens[other.front].previous = tokens.back;
+            if (tokens.back == c_noToken)
+            {
+                tokens.front = other.front;
+            }
+            else
+            {
+                m_tokens[tokens.back].next = other.front;
+            }
+            tokens.back = other.back;
+            other.front = c_noToken;
+            other.back = c_noToken;
+        }
+
+        if (other.emphasisFront != c_noToken)
+        {
+            if (tokens.emphasisBack == c_noToken)
+            {
+                tokens.emphasisFront = other.emphasisFront;
+            }
+            else
+            {
+                m_tokens[tokens.emphasisBack].nextEmphasis = other.emphasisFront;
+            }
+            tokens.emphasisBack = other.emphasisBack;
+            other.emphasisFront = c_noToken;
+            other.emphasisBack = c_noToken;
+        }
+
+        tokens.hasHtmlTags = tokens.hasHtmlTags || other.hasHtmlTags;
+        tokens.isCaptured = other.isCaptured;
+    }
+
+    // when a token of a different block type follows, close the current block and open a new one
+    void MarkDownTokenizer::MarkTags(MarkDownTokenList& tokens, int token)
+    {
+        if (GetBlockType(m_tokens[tokens.back].type) != GetBlockType(m_tokens[token].type))
+        {
+            if (m_tokens[tokens.back].type == MarkDownTokenType::NewLine)
+            {
+                PopBack(tokens);
+            }
+
+            if (tokens.back != c_noToken)
+            {
+                m_tokens[tokens.back].isTail = true;
+            }
+            m_tokens[token].isHead = true;
+        }
+    }
+
+    void MarkDownTokenizer::PopFront(MarkDownTokenList& tokens)
+    {
+        if (tokens.front != c_noToken)
+        {
+            tokens.front = m_tokens[tokens.front].next;
+            if (tokens.front == c_noToken)
+            {
+                tokens.back = c_noToken;
+            }
+            else
+            {
+                m_tokens[tokens.front].previous = c_noToken;
+            }
+        }
+    }
+
+    void MarkDownTokenizer::PopBack(MarkDownTokenList& tokens)
+    {
+        if (tokens.back != c_noToken)
+        {
+            tokens.back = m_tokens[tokens.back].previous;
+            if (tokens.back == c_noToken)
+            {
+                tokens.front = c_noToken;
+            }
+            else
+            {
+                m_tokens[tokens.back].next = c_noToken;
+            }
+        }
+    }
+
+    void MarkDownTokenizer::Clear(MarkDownTokenList& tokens)
+    {
+        tokens.front = c_noToken;
+        tokens.back = c_noToken;
+        tokens.emphasisFront = c_noToken;
+        tokens.emphasisBack = c_noToken;
+    }
+
+    bool MarkDownTokenizer::IsLeftEmphasis(int token) const
+    {
+        const MarkDownToken& emphasis = m_tokens[token];
+        return emphasis.type == MarkDownTokenType::LeftEmphasis ||
+            (emphasis.type == MarkDownTokenType::LeftAndRightEmphasis && emphasis.isLeftDirection);
+    }
+
+    bool MarkDownTokenizer::IsRightEmphasis(int token) const
+    {
+        const MarkDownToken& emphasis = m_tokens[token];
+        return emphasis.type == MarkDownTokenType::RightEmphasis ||
+            (emphasis.type == MarkDownTokenType::LeftAndRightEmphasis && !emphasis.isLeftDirection);
+    }
+
+    // same type, and if either is both left and right emphasis, the sum of their delimiters isn't a multiple of 3
+    bool MarkDownTokenizer::IsMatch(int leftToken, int rightToken) const
+    {
+        const MarkDownToken& left = m_tokens[leftToken];
+        const MarkDownToken& right = m_tokens[rightToken];
+        if (left.delimiterType == right.delimiterType)
+        {
+            return !((left.type == MarkDownTokenType::LeftAndRightEmphasis || right.type == MarkDownTokenType::LeftAndRightEmphasis) &&
+                     (((left.unusedDelimiters + right.unusedDelimiters) % 3) == 0));
+        }
+        return false;
+    }
+
+    void MarkDownTokenizer::PushTag(int token, bool isBold, std::vector<MarkDownTag>& tags)
+    {
+        MarkDownToken& emphasis = m_tokens[token];
+        const bool isOpening = emphasis.type == MarkDownTokenType::LeftEmphasis ||
+            (emphasis.type == MarkDownTokenType::LeftAndRightEmphasis && emphasis.isLeftDirection);
+        const EmphasisTag tag = isBold ? (isOpening ? EmphasisTag::OpeningBold : EmphasisTag::ClosingBold) :
+                                         (isOpening ? EmphasisTag::OpeningItalic : EmphasisTag::ClosingItalic);
+
+        const int tagIndex = static_cast<int>(tags.size());
+        tags.push_back({tag, c_noToken});
+        if (emphasis.type == MarkDownTokenType::LeftEmphasis)
+        {
+            // left emphasis writes its tags in the reverse order
+            tags.back().next = emphasis.firstTag;
+            emphasis.firstTag = tagIndex;
+        }
+        else
+        {
+            if (emphasis.lastTag == c_noToken)
+            {
+                emphasis.firstTag = tagIndex;
+            }
+            else
+            {
+                tags[emphasis.lastTag].next = tagIndex;
+            }
+            emphasis.lastTag = tagIndex;
+        }
+    }
+
+    // as MarkDownEmphasisHtmlGenerator::GenerateTags
+    bool MarkDownTokenizer::GenerateTags(int leftToken, int rightToken, std::vector<MarkDownTag>& tags)
+    {
+        MarkDownToken& left = m_tokens[leftToken];
+        MarkDownToken& right = m_tokens[rightToken];
+        const int leftOver = left.unusedDelimiters - right.unusedDelimiters;
+        int delimiterCount = 0;
+        if (leftOver >= 0)
+        {
+            delimiterCount = left.unusedDelimiters - leftOver;
+            left.unusedDelimiters = leftOver;
+            right.unusedDelimiters = 0;
+        }
+        else
+        {
+            delimiterCount = left.unusedDelimiters;
+            right.unusedDelimiters = -leftOver;
+            left.unusedDelimiters = 0;
+        }
+
+        if (delimiterCount % 2)
+        {
+            PushTag(leftToken, false, tags);
+            PushTag(rightToken, false, tags);
+        }
+
+        for (int i = 0; i < delimiterCount / 2; i++)
+        {
+            PushTag(leftToken, true, tags);
+            PushTag(rightToken, true, tags);
+        }
+        return delimiterCount > 0;
+    }
+
+    // MarkDownParsedResult::MatchLeftAndRightEmphasises over the lookup table of the given list; see there for the rules
+    void MarkDownTokenizer::MatchLeftAndRightEmphasises(MarkDownTokenList& tokens, std::vector<MarkDownTag>& tags)
+    {
+        m_leftEmphasisToExplore.clear();
+        MatchEmphasises(tokens.emphasisFront, tags, tokens.hasHtmlTags, false);
+    }
+
+    // Matches the emphasis from currentEmphasis on to the left emphasis in m_leftEmphasisToExplore and those after it.
+    // Each emphasis is done with before the next one is looked at, so the state once past the tokens of the parse
+    // checkpoint can be saved and carried on from.
+    void MarkDownTokenizer::MatchEmphasises(int currentEmphasis, std::vector<MarkDownTag>& tags, bool& hasHtmlTags, bool isSavingCheckpoint)
+    {
+        while (true)
+        {
+            if (isSavingCheckpoint)
+            {
+                isSavingCheckpoint = SaveMatchCheckpoints(currentEmphasis, tags, hasHtmlTags);
+            }
+
+            if (currentEmphasis == c_noToken)
+            {
+                break;
+            }
+
+            const bool isLeftAndRight = m_tokens[currentEmphasis].type == MarkDownTokenType::LeftAndRightEmphasis;
+            if (IsLeftEmphasis(currentEmphasis) || (isLeftAndRight && m_leftEmphasisToExplore.empty()))
+            {
+                if (isLeftAndRight && IsRightEmphasis(currentEmphasis))
+                {
+                    m_tokens[currentEmphasis].isLeftDirection = true;
+                }
+
+                m_leftEmphasisToExplore.push_back(currentEmphasis);
+                currentEmphasis = m_tokens[currentEmphasis].nextEmphasis;
+            }
+            else if (!m_leftEmphasisToExplore.empty())
+            {
+                int currentLeftEmphasis = m_leftEmphasisToExplore.back();
+                if (!IsMatch(currentLeftEmphasis, currentEmphasis))
+                {
+                    // prefer the closest matching left emphasis, dropping the unmatched ones on the way
+                    m_unmatchedLeftEmphasis.clear();
+                    bool isFound = false;
+                    while (!m_leftEmphasisToExplore.empty() && !isFound)
+                    {
+                        const int leftToken = m_leftEmphasisToExplore.back();
+                        if (IsMatch(leftToken, currentEmphasis))
+                        {
+                            currentLeftEmphasis = leftToken;
+                            isFound = true;
+                        }
+                        else
+                        {
+                            m_leftEmphasisToExplore.pop_back();
+                            m_unmatchedLeftEmphasis.push_back(leftToken);
+                        }
+                    }
+
+                    if (!isFound)
+                    {
+                        while (!m_unmatchedLeftEmphasis.empty())
+                        {
+                            m_leftEmphasisToExplore.push_back(m_unmatchedLeftEmphasis.back());
+                            m_unmatchedLeftEmphasis.pop_back();
+                        }
+
+                        // a left and right emphasis of the same type becomes a left emphasis. Reversing a right
+                        // emphasis wouldn't change anything, and MarkDownParsedResult loops forever on it, so it's
+                        // skipped like one of another type.
+                        if (isLeftAndRight &&
+                            m_tokens[m_leftEmphasisToExplore.back()].delimiterType == m_tokens[currentEmphasis].delimiterType)
+                        {
+                            m_tokens[currentEmphasis].isLeftDirection = !m_tokens[currentEmphasis].isLeftDirection;
+                        }
+                        else
+                        {
+                            currentEmphasis = m_tokens[currentEmphasis].nextEmphasis;
+                        }
+                        continue;
+                    }
+                }
+
+                hasHtmlTags = GenerateTags(currentLeftEmphasis, currentEmphasis, tags) || hasHtmlTags;
+
+                if (m_tokens[currentEmphasis].unusedDelimiters == 0)
+                {
+                    currentEmphasis = m_tokens[currentEmphasis].nextEmphasis;
+                }
+
+                if (m_tokens[currentLeftEmphasis].unusedDelimiters == 0)
+                {
+                    m_leftEmphasisToExplore.pop_back();
+                }
+            }
+            else
+            {
+                currentEmphasis = m_tokens[currentEmphasis].nextEmphasis;
+            }
+        }
+    }
+
+    // what the MarkDownHtmlGenerator of each token generates, for the list starting at front whose emphasis tags are in
+    // the given vector
+    void MarkDownTokenizer::WriteHtml(int front, const std::vector<MarkDownTag>& tags, std::string& html) const
+    {
+        for (int index = front; index != c_noToken; index = m_tokens[index].next)
+        {
+            WriteHtml(m_tokens[index], tags, html);
+        }
+    }
+
+    // the html of the token but for its first writtenSize bytes, which only a text token whose start is final has
+    void MarkDownTokenizer::WriteHtml(const MarkDownToken& token, const std::vector<MarkDownTag>& tags, std::size_t writtenSize, std::string& html) const
+    {
+        if (writtenSize == 0)
+        {
+            WriteHtml(token, tags, html);
+            return;
+        }
+
+        const std::size_t writtenText = writtenSize - (token.isHead ? c_paragraphHead.size() : 0);
+        html.append(m_arena, token.textOffset + writtenText, token.textLength - writtenText);
+        if (token.isTail)
+        {
+            html += "</p>";
+        }
+    }
+
+    void MarkDownTokenizer::WriteHtml(const MarkDownToken& token, const std::vector<MarkDownTag>& tags, std::string& html) const
+    {
+        static constexpr std::string_view tagHtml[] = {"<em>", "</em>", "<strong>", "</strong>"};
+
+        const MarkDownBlockType blockType = GetBlockType(token.type);
+        if (token.isHead)
+        {
+            if (blockType == MarkDownBlockType::BulletedListItem)
+            {
+                html += "<ul>";
+            }
+            else if (blockType == MarkDownBlockType::NumberedListItem)
+            {
+                html += "<ol start=\"";
+                html += m_text.substr(token.numberOffset, token.numberLength);
+                html += "\">";
+            }
+            else
+            {
+                html += c_paragraphHead;
+            }
+        }
+
+        switch (token.type)
+        {
+        case MarkDownTokenType::Text:
+        case MarkDownTokenType::NewLine:
+            html.append(m_arena, token.textOffset, token.textLength);
+            break;
+        case MarkDownTokenType::LeftEmphasis:
+        case MarkDownTokenType::RightEmphasis:
+        case MarkDownTokenType::LeftAndRightEmphasis:
+        {
+            // unused delimiters are written as text; before the tags of a left emphasis and after all others
+            const std::size_t unusedOffset = token.textOffset + token.textLength - token.unusedDelimiters;
+            const bool isLeft = token.type == MarkDownTokenType::LeftEmphasis;
+
+            if (isLeft && token.unusedDelimiters)
+            {
+                html.append(m_arena, unusedOffset, token.unusedDelimiters);
+            }
+
+            for (int tag = token.firstTag; tag != c_noToken; tag = tags[tag].next)
+            {
+                html += tagHtml[static_cast<std::size_t>(tags[tag].tag)];
+            }
+
+            if (!isLeft && token.unusedDelimiters)
+            {
+                html.append(m_arena, unusedOffset, token.unusedDelimiters);
+            }
+            break;
+        }
+        case MarkDownTokenType::Link:
+            html += "<a href=\"";
+            WriteHtml(token.destination, m_tags, html);
+            html += "\">";
+            WriteHtml(token.firstChild, m_tags, html);
+            html += "</a>";
+            break;
+        case MarkDownTokenType::ListItem:
+        case MarkDownTokenType::OrderedListItem:
+            html += "<li>";
+            WriteHtml(token.firstChild, m_tags, html);
+            html += "</li>";
+            break;
+        }
+
+        if (token.isTail)
+        {
+            html += (blockType == MarkDownBlockType::BulletedListItem) ?
+                "</ul>" :
+                ((blockType == MarkDownBlockType::NumberedListItem) ? "</ol>" : "</p>");
+        }
+    }
+
+    // the runs of the list starting at front, following the html WriteHtml writes for it
+    void MarkDownTokenizer::AppendRuns(int front, const std::vector<MarkDownTag>& tags, MarkDownRunStyle style, MarkDownRunBlock& block, std::vector<MarkDownRun>& runs) const
+    {
+        for (int index = front; index != c_noToken; index = m_tokens[index].next)
+        {
+            const MarkDownToken& token = m_tokens[index];
+            const MarkDownBlockType blockType = GetBlockType(token.type);
+            if (blockType != MarkDownBlockType::Paragraph)
+            {
+                // a nested list has no <ol> of its own, as its first item is never a head
+                if (blockType == MarkDownBlockType::NumberedListItem && (token.isHead || block.blockType != blockType))
+                {
+                    block.listStartOffset = token.numberOffset;
+                    block.listStartLength = token.numberLength;
+                }
+                StartBlock(blockType, block, runs);
+            }
+            else if (token.isHead && !block.listItemDepth)
+            {
+                // a paragraph in a list item goes on with the item
+                StartBlock(MarkDownBlockType::Paragraph, block, runs);
+            }
+
+            switch (token.type)
+            {
+            case MarkDownTokenType::Text:
+            case MarkDownTokenType::NewLine:
+                AddRun(token.sourceOffset, token.sourceLength, style, block, runs);
+                break;
+            case MarkDownTokenType::LeftEmphasis:
+            case MarkDownTokenType::RightEmphasis:
+            case MarkDownTokenType::LeftAndRightEmphasis:
+            {
+                const std::size_t unusedOffset = token.sourceOffset + token.sourceLength - token.unusedDelimiters;
+                const bool isLeft = token.type == MarkDownTokenType::LeftEmphasis;
+
+                if (isLeft)
+                {
+                    AddRun(unusedOffset, token.unusedDelimiters, style, block, runs);
+                }
+
+                for (int tag = token.firstTag; tag != c_noToken; tag = tags[tag].next)
+                {
+                    switch (tags[tag].tag)
+                    {
+                    case EmphasisTag::OpeningItalic:
+                        ++style.italicTags;
+                        break;
+                    case EmphasisTag::ClosingItalic:
+                        --style.italicTags;
+                        break;
+                    case EmphasisTag::OpeningBold:
+                        ++style.boldTags;
+                        break;
+                    case EmphasisTag::ClosingBold:
+                        --style.boldTags;
+                        break;
+                    }
+                }
+
+                if (!isLeft)
+                {
+                    AddRun(unusedOffset, token.unusedDelimiters, style, block, runs);
+                }
+                break;
+            }
+            case MarkDownTokenType::Link:
+            {
+                MarkDownRunStyle linkStyle = style;
+                linkStyle.isLink = true;
+                linkStyle.link.clear();
+                AppendPlainText(token.destination, linkStyle.link);
+                AppendRuns(token.firstChild, m_tags, linkStyle, block, runs);
+                break;
+            }
+            case MarkDownTokenType::ListItem:
+            case MarkDownTokenType::OrderedListItem:
+                ++block.listItemDepth;
+                AppendRuns(token.firstChild, m_tags, style, block, runs);
+                --block.listItemDepth;
+                break;
+            }
+        }
+    }
+
+    // the text of the list starting at front without any markup, as in the html WriteHtml writes for it
+    void MarkDownTokenizer::AppendPlainText(int front, std::string& text) const
+    {
+        for (int index = front; index != c_noToken; index = m_tokens[index].next)
+        {
+            const MarkDownToken& token = m_tokens[index];
+            switch (token.type)
+            {
+            case MarkDownTokenType::Text:
+            case MarkDownTokenType::NewLine:
+                text += m_text.substr(token.sourceOffset, token.sourceLength);
+                break;
+            case MarkDownTokenType::LeftEmphasis:
+            case MarkDownTokenType::RightEmphasis:
+            case MarkDownTokenType::LeftAndRightEmphasis:
+                text += m_text.substr(token.sourceOffset + token.sourceLength - token.unusedDelimiters, token.unusedDelimiters);
+                break;
+            case MarkDownTokenType::Link:
+            case MarkDownTokenType::ListItem:
+            case MarkDownTokenType::OrderedListItem:
+                AppendPlainText(token.firstChild, text);
+                break;
+            }
+        }
+    }
+
+    void MarkDownTokenizer::StartBlock(MarkDownBlockType blockType, MarkDownRunBlock& block, std::vector<MarkDownRun>& runs)
+    {
+        EndBlock(block, runs);
+        block.blockType = blockType;
+        block.isBlockStart = true;
+    }
+
+    // a block without any text gets an empty run
+    void MarkDownTokenizer::EndBlock(MarkDownRunBlock& block, std::vector<MarkDownRun>& runs)
+    {
+        if (block.isBlockStart)
+        {
+            const bool isNumbered = block.blockType == MarkDownBlockType::NumberedListItem;
+            runs.push_back({0, 0, block.blockType, true, false, false, false, {}, isNumbered ? block.listStartOffset : 0,
+                            isNumbered ? block.listStartLength : 0});
+            block.isBlockStart = false;
+        }
+    }
+
+    // Adds a run, or extends the last one if it has the same style and ends where this one starts
+    void MarkDownTokenizer::AddRun(std::size_t offset, std::size_t length, const MarkDownRunStyle& style, MarkDownRunBlock& block, std::vector<MarkDownRun>& runs)
+    {
+        if (!length)
+        {
+            return;
+        }
+
+        const bool isBold = style.boldTags > 0;
+        const bool isItalic = style.italicTags > 0;
+        const bool isNumbered = block.blockType == MarkDownBlockType::NumberedListItem;
+        if (!block.isBlockStart && !runs.empty())
+        {
+            MarkDownRun& last = runs.back();
+            if (last.textOffset + last.textLength == offset && last.blockType == block.blockType && last.isBold == isBold &&
+                last.isItalic == isItalic && last.isLink == style.isLink && last.link == style.link)
+            {
+                last.textLength += length;
+                return;
+            }
+        }
+
+        runs.push_back({offset, length, block.blockType, block.isBlockStart, isBold, isItalic, style.isLink, style.link,
+                        isNumbered ? block.listStartOffset : 0, isNumbered ? block.listStartLength : 0});
+        block.isBlockStart = false;
+    }
+
+    MarkDownTokenList MarkDownTokenizer::Parse()
+    {
+        MarkDownTokenList tokens;
+        while (!m_eof)
+        {
+            ParseBlock(tokens);
+        }
+
+        MatchLeftAndRightEmphasises(tokens, m_topLevelTags);
+
+        // add block tags such as <p> <ul>
+        if (tokens.front != c_noToken)
+        {
+            m_tokens[tokens.front].isHead = true;
+            m_tokens[tokens.back].isTail = true;
+        }
+        return tokens;
+    }
+
+    bool MarkDownTokenizer::TransformToHtml(std::string& html)
+    {
+        const MarkDownTokenList tokens = Parse();
+        if (tokens.front == c_noToken)
+        {
+            html += "<p></p>";
+            return tokens.hasHtmlTags;
+        }
+
+        html.reserve(html.size() + m_arena.size() + (m_tags.size() + m_topLevelTags.size()) * 9 + 32);
+        WriteHtml(tokens.front, m_topLevelTags, html);
+        return tokens.hasHtmlTags;
+    }
+
+    bool MarkDownTokenizer::TransformToRuns(std::vector<MarkDownRun>& runs)
+    {
+        const MarkDownTokenList tokens = Parse();
+        MarkDownRunBlock block;
+        if (tokens.front == c_noToken)
+        {
+            StartBlock(MarkDownBlockType::Paragraph, block, runs);
+        }
+        AppendRuns(tokens.front, m_topLevelTags, {}, block, runs);
+        EndBlock(block, runs);
+        return tokens.hasHtmlTags;
+    }
+
+    bool MarkDownTokenizer::TransformAppendedToHtml(std::string_view text, std::string& html, std::size_t& unchangedSize)
+    {
+        m_text = text;
+        const MarkDownTokenList blocks = ParseAppended();
+        const bool hasHtmlTags = MatchAppendedEmphasises(blocks) || blocks.hasHtmlTags;
+
+        unchangedSize = m_finalHtml.size;
+        html.resize(m_finalHtml.size);
+        if (blocks.front == c_noToken)
+        {
+            html += "<p></p>";
+            return hasHtmlTags;
+        }
+
+        m_tokens[blocks.front].isHead = true;
+        m_tokens[blocks.back].isTail = true;
+
+        // the html of the tokens before the first one that may still change is written for good
+        int firstChangeable = m_parseCheckpoint.firstChangeable;
+        for (const auto& emphasis : m_matchCheckpoint.leftEmphasisToExplore)
+        {
+            firstChangeable = std::min(firstChangeable, emphasis.token);
+        }
+
+        std::size_t writtenSize = m_finalHtml.partialSize;
+        int index = (m_finalHtml.lastToken == c_noToken) ? blocks.front : m_tokens[m_finalHtml.lastToken].next;
+        for (; index != c_noToken && index < firstChangeable; index = m_tokens[index].next)
+        {
+            WriteHtml(m_tokens[index], m_topLevelTags, writtenSize, html);
+            writtenSize = 0;
+            m_finalHtml.lastToken = index;
+            m_finalHtml.partialSize = 0;
+        }
+        m_finalHtml.size = html.size();
+
+        // So is the text a checkpoint in a run of text is partway through, as far as the checkpoint, unless a left
+        // emphasis before it may still change. The tokens from the first changeable one to it only have their links
+        // changed by what's appended, as the run it ends carries on as text.
+        const bool isTextFinal = m_parseCheckpoint.isInText && m_matchCheckpoint.leftEmphasisToExplore.empty();
+        for (; index != c_noToken; index = m_tokens[index].next)
+        {
+            const MarkDownToken& token = m_tokens[index];
+            const std::size_t start = html.size() - writtenSize;
+            WriteHtml(token, m_topLevelTags, writtenSize, html);
+            writtenSize = 0;
+
+            if (isTextFinal && token.type == MarkDownTokenType::Text && token.textOffset == m_parseCheckpoint.state.tokenOffset)
+            {
+                // an escape char at the end is dropped if a keyword follows
+                const EmphasisParserState& state = m_parseCheckpoint.state;
+                const std::size_t finalText = m_parseCheckpoint.arenaSize - state.tokenOffset -
+                    ((state.lookBehind == DelimiterType::Escape) ? 1 : 0);
+                if (finalText > 0)
+                {
+                    m_finalHtml.lastToken = token.previous;
+                    m_finalHtml.partialSize = (token.isHead ? c_paragraphHead.size() : 0) + finalText;
+                    m_finalHtml.size = start + m_finalHtml.partialSize;
+                }
+            }
+        }
+        return hasHtmlTags;
+    }
+
+    // Parse, carrying on from the checkpoint and saving one after each top-level block that didn't read to the end.
+    // When the text appended ends the link text of a '[' parsed on past as text, it's parsed again from the '['.
+    MarkDownTokenList MarkDownTokenizer::ParseAppended()
+    {
+        MarkDownTokenList blocks;
+        ParseFromCheckpoint(blocks);
+        while (m_isLinkTextEnded)
+        {
+            MarkDownLinkCheckpoint& link = m_linkCheckpoints.back();
+            m_endedLinkPosition = link.parse.position;
+            m_parseCheckpoint = std::move(link.parse);
+            m_matchCheckpoint = std::move(link.match);
+            m_finalHtml = link.finalHtml;
+            m_linkCheckpoints.pop_back();
+            ParseFromCheckpoint(blocks);
+        }
+        return blocks;
+    }
+
+    void MarkDownTokenizer::ParseFromCheckpoint(MarkDownTokenList& blocks)
+    {
+        m_isLinkTextEnded = false;
+        while (!m_linkCheckpoints.empty() && m_linkCheckpoints.back().parse.position >= m_parseCheckpoint.position)
+        {
+            m_linkCheckpoints.pop_back();
+        }
+        m_linkMatchIndex = std::min(m_linkMatchIndex, m_linkCheckpoints.size());
+
+        RestoreCheckpoint(blocks);
+        m_checkpointBlocks = &blocks;
+
+        if (m_parseCheckpoint.isInText)
+        {
+            MarkDownTokenList textTokens = m_parseCheckpoint.textTokens;
+            EmphasisParserState state = m_parseCheckpoint.state;
+            ParseTextAndEmphasis(blocks, textTokens, state);
+            if (!m_hasReadToEnd)
+            {
+                SaveCheckpoint(blocks, nullptr, nullptr);
+            }
+        }
+
+        while (!m_eof)
+        {
+            ParseBlock(blocks);
+            if (!m_hasReadToEnd)
+            {
+                SaveCheckpoint(blocks, nullptr, nullptr);
+            }
+        }
+
+        m_checkpointBlocks = nullptr;
+    }
+
+    // textTokens and state are those of the run of text being parsed, if any
+    void MarkDownTokenizer::SaveCheckpoint(const MarkDownTokenList& blocks, const MarkDownTokenList* textTokens, const EmphasisParserState* state)
+    {
+        MarkDownParseCheckpoint& checkpoint = m_parseCheckpoint;
+        checkpoint.position = m_position;
+        checkpoint.arenaSize = m_arena.size();
+        checkpoint.tokenCount = m_tokens.size();
+        checkpoint.tagCount = m_tags.size();
+        checkpoint.blocks = blocks;
+        checkpoint.isInText = (textTokens != nullptr);
+        checkpoint.lastEmphasis = blocks.emphasisBack;
+        checkpoint.changeable.clear();
+
+        // appending to a list changes the links of its back and of the back of its lookup table. When a block of
+        // another type follows, the back gets a block tag, or gives way to the one before it if it's a new line.
+        const int beforeBack = (blocks.back == c_noToken) ? c_noToken : m_tokens[blocks.back].previous;
+        AddChangeable(blocks.back);
+        AddChangeable(beforeBack);
+        AddChangeable(blocks.emphasisBack);
+        int firstChangeable = static_cast<int>(m_tokens.size());
+        for (const int token : {blocks.back, beforeBack})
+        {
+            if (token != c_noToken)
+            {
+                firstChangeable = std::min(firstChangeable, token);
+            }
+        }
+
+        if (textTokens)
+        {
+            // the run of text is appended to the blocks once it ends
+            checkpoint.textTokens = *textTokens;
+            checkpoint.state = *state;
+            AddChangeable(textTokens->front);
+            AddChangeable(textTokens->back);
+            AddChangeable(textTokens->emphasisBack);
+            if (textTokens->front != c_noToken)
+            {
+                firstChangeable = std::min(firstChangeable, textTokens->front);
+            }
+            if (textTokens->emphasisBack != c_noToken)
+            {
+                checkpoint.lastEmphasis = textTokens->emphasisBack;
+            }
+        }
+        checkpoint.firstChangeable = firstChangeable;
+    }
+
+    void MarkDownTokenizer::AddChangeable(int token)
+    {
+        if (token != c_noToken)
+        {
+            const MarkDownToken& links = m_tokens[token];
+            m_parseCheckpoint.changeable.push_back({token, links.isHead, links.isTail, links.previous, links.next, links.nextEmphasis});
+        }
+    }
+
+    // Back to the state at the checkpoint; tokens and tags after it are dropped, and those it left changeable restored
+    void MarkDownTokenizer::RestoreCheckpoint(MarkDownTokenList& blocks)
+    {
+        const MarkDownParseCheckpoint& checkpoint = m_parseCheckpoint;
+        m_position = checkpoint.position;
+        m_eof = false;
+        m_fail = false;
+        m_hasReadToEnd = false;
+        m_arena.resize(checkpoint.arenaSize);
+        m_tokens.resize(checkpoint.tokenCount);
+        m_tags.resize(checkpoint.tagCount);
+
+        for (const auto& links : checkpoint.changeable)
+        {
+            MarkDownToken& token = m_tokens[links.token];
+            token.isHead = links.isHead;
+            token.isTail = links.isTail;
+            token.previous = links.previous;
+            token.next = links.next;
+            token.nextEmphasis = links.nextEmphasis;
+        }
+        blocks = checkpoint.blocks;
+    }
+
+    // Matches the top-level emphasis from the match checkpoint on. The left emphasis it had yet to match there get back
+    // their delimiters and tags, and the tags generated since are dropped.
+    bool MarkDownTokenizer::MatchAppendedEmphasises(const MarkDownTokenList& blocks)
+    {
+        const MarkDownMatchCheckpoint& checkpoint = m_matchCheckpoint;
+        m_topLevelTags.resize(checkpoint.tagCount);
+        m_leftEmphasisToExplore.clear();
+        for (const auto& emphasis : checkpoint.leftEmphasisToExplore)
+        {
+            MarkDownToken& token = m_tokens[emphasis.token];
+            token.unusedDelimiters = emphasis.unusedDelimiters;
+            token.isLeftDirection = emphasis.isLeftDirection;
+            token.firstTag = emphasis.firstTag;
+            token.lastTag = emphasis.lastTag;
+            if (token.lastTag != c_noToken)
+            {
+                m_topLevelTags[token.lastTag].next = c_noToken;
+            }
+            m_leftEmphasisToExplore.push_back(emphasis.token);
+        }
+
+        bool hasHtmlTags = checkpoint.hasHtmlTags;
+        const int currentEmphasis =
+            (checkpoint.lastEmphasis == c_noToken) ? blocks.emphasisFront : m_tokens[checkpoint.lastEmphasis].nextEmphasis;
+        MatchEmphasises(currentEmphasis, m_topLevelTags, hasHtmlTags, true);
+        return hasHtmlTags;
+    }
+
+    // Saves the match checkpoints of the parse checkpoints currentEmphasis is past, those of the '[' parsed on past as
+    // text coming first. Returns whether any is left to save.
+    bool MarkDownTokenizer::SaveMatchCheckpoints(int currentEmphasis, const std::vector<MarkDownTag>& tags, bool hasHtmlTags)
+    {
+        const auto isPast = [currentEmphasis](const MarkDownParseCheckpoint& checkpoint) {
+            return currentEmphasis == c_noToken || currentEmphasis >= static_cast<int>(checkpoint.tokenCount);
+        };
+
+        for (; m_linkMatchIndex < m_linkCheckpoints.size() && isPast(m_linkCheckpoints[m_linkMatchIndex].parse); ++m_linkMatchIndex)
+        {
+            MarkDownLinkCheckpoint& link = m_linkCheckpoints[m_linkMatchIndex];
+            SaveMatchCheckpoint(link.parse, link.match, tags, hasHtmlTags);
+        }
+
+        if (!isPast(m_parseCheckpoint))
+        {
+            return true;
+        }
+        SaveMatchCheckpoint(m_parseCheckpoint, m_matchCheckpoint, tags, hasHtmlTags);
+        return false;
+    }
+
+    void MarkDownTokenizer::SaveMatchCheckpoint(const MarkDownParseCheckpoint& parseCheckpoint, MarkDownMatchCheckpoint& checkpoint, const std::vector<MarkDownTag>& tags, bool hasHtmlTags)
+    {
+        checkpoint.lastEmphasis = parseCheckpoint.lastEmphasis;
+        checkpoint.tagCount = tags.size();
+        checkpoint.hasHtmlTags = hasHtmlTags;
+        checkpoint.leftEmphasisToExplore.clear();
+        for (const int token : m_leftEmphasisToExplore)
+        {
+            const MarkDownToken& emphasis = m_tokens[token];
+            checkpoint.leftEmphasisToExplore.push_back(
+                {token, emphasis.unusedDelimiters, emphasis.isLeftDirection, emphasis.firstTag, emphasis.lastTag});
+        }
+    }
+
+    // Parses according to each key words
+    void MarkDownTokenizer::ParseBlock(MarkDownTokenList& tokens)
+    {
+        switch (Peek())
+        {
+        case '[':
+        {
+            // MatchLink reads on to the end of the text while no ']' ends the link text, and then leaves the '[' as
+            // text before what it parsed, which is what parsing on at the top level gives. Doing that right away
+            // keeps saving checkpoints after it, with one to go back to if a ']' turns up.
+            if (&tokens == m_checkpointBlocks && m_position == m_parseCheckpoint.position &&
+                !m_parseCheckpoint.isInText && m_position != m_endedLinkPosition && !m_isLinkTextEnded)
+            {
+                m_linkCheckpoints.push_back({m_parseCheckpoint, m_matchCheckpoint, m_finalHtml});
+                AddCharToken(tokens, Get());
+                break;
+            }
+
+            MarkDownTokenList linkTokens;
+            MatchLink(linkTokens);
+            AppendTokenList(tokens, linkTokens);
+            break;
+        }
+        case ']':
+            if (&tokens == m_checkpointBlocks && !m_linkCheckpoints.empty())
+            {
+                m_isLinkTextEnded = true;
+            }
+            AddCharToken(tokens, Get());
+            break;
+        case ')':
+            AddCharToken(tokens, Get());
+            break;
+        case '\n':
+        case '\r':
+            AddNewLineToken(tokens, Get());
+            break;
+        case '-':
+        case '+':
+        case '*':
+        {
+            MarkDownTokenList listTokens;
+            MatchList(listTokens);
+            AppendTokenList(tokens, listTokens);
+            break;
+        }
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+        {
+            MarkDownTokenList listTokens;
+            MatchOrderedList(listTokens);
+            AppendTokenList(tokens, listTokens);
+            break;
+        }
+        default:
+            ParseTextAndEmphasis(tokens);
+        }
+    }
+
+    void MarkDownTokenizer::ParseTextAndEmphasis(MarkDownTokenList& tokens)
+    {
+        MarkDownTokenList emphasisTokens;
+        EmphasisParserState state;
+        state.tokenOffset = m_arena.size();
+        state.sourceOffset = m_position;
+        ParseTextAndEmphasis(tokens, emphasisTokens, state);
+    }
+
+    // EmphasisParser::Match, with its text and emphasis states as the two halves of the loop. It starts in the text
+    // state with the tokens and state collected so far, which is where a checkpoint in a run of text carries on from.
+    void MarkDownTokenizer::ParseTextAndEmphasis(MarkDownTokenList& tokens, MarkDownTokenList& emphasisTokens, EmphasisParserState& state)
+    {
+        bool isEmphasis = false;
+
+        while (true)
+        {
+            if (!isEmphasis)
+            {
+                ScanPlainText(state);
+
+                if (&tokens == m_checkpointBlocks && !m_hasReadToEnd)
+                {
+                    SaveCheckpoint(tokens, &emphasisTokens, &state);
+                }
+
+                const int ch = Peek();
+                const bool isKeyword = IsKeyword(ch);
+                if (m_eof || (state.lookBehind != DelimiterType::Escape && isKeyword))
+                {
+                    CaptureText(emphasisTokens, state, m_position);
+                    break;
+                }
+
+                if ((ch == '*' || ch == '_') && state.lookBehind != DelimiterType::Escape)
+                {
+                    // encountered first emphasis delimiter
+                    CaptureText(emphasisTokens, state, m_position);
+                    if (m_position)
+                    {
+                        UpdateLookBehind(state, static_cast<unsigned char>(m_text[m_position - 1]));
+                    }
+                    UpdateCurrentEmphasisRunState(state, (ch == '*') ? DelimiterType::Asterisk : DelimiterType::Underscore);
+                    m_arena += static_cast<char>(Get());
+                    isEmphasis = true;
+                }
+                else
+                {
+                    if (isKeyword && m_arena.size() > state.tokenOffset)
+                    {
+                        // the keyword is escaped, remove the escape char. What's before it becomes a token of its own,
+                        // as the text of a token is one range of the text being parsed.
+                        m_arena.pop_back();
+                        CaptureText(emphasisTokens, state, m_position - 1);
+                        state.sourceOffset = m_position;
+                    }
+                    UpdateLookBehind(state, ch);
+                    AppendEscaped(static_cast<char>(Get()));
+                }
+            }
+            else
+            {
+                const int ch = Peek();
+                if (IsKeyword(ch) || m_eof)
+                {
+                    CaptureEmphasis(emphasisTokens, state, ch);
+                    break;
+                }
+
+                if ((ch == '*' || ch == '_') && state.lookBehind != DelimiterType::Escape)
+                {
+                    // another emphasis delimiter, the run continues
+                    const DelimiterType emphasisType = (ch == '*') ? DelimiterType::Asterisk : DelimiterType::Underscore;
+                    if (state.delimiterType == emphasisType)
+                    {
+                        UpdateCurrentEmphasisRunState(state, emphasisType);
+                    }
+                    m_arena += static_cast<char>(Get());
+                }
+                else
+                {
+                    // delimiter run ended, capture it as emphasis
+                    CaptureEmphasis(emphasisTokens, state, ch);
+                    if (ch == '\\')
+                    {
+                        // skips escape char
+                        Get();
+                        state.sourceOffset = m_position;
+                    }
+
+                    state.delimiterCount = 0;
+                    UpdateLookBehind(state, Peek());
+                    const int next = Get();
+                    // a stream leaves the char it failed to get as '\0'
+                    AppendEscaped((next == EOF) ? '\0' : static_cast<char>(next));
+                    isEmphasis = false;
+                }
+            }
+        }
+
+        AppendTokenList(tokens, emphasisTokens);
+    }
+
+    // Consumes the text up to the next special char in one go, as MatchText would one char at a time
+    void MarkDownTokenizer::ScanPlainText(EmphasisParserState& state)
+    {
+        if (m_eof || m_fail || state.lookBehind == DelimiterType::Escape)
+        {
+            return;
+        }
+
+        const std::size_t start = m_position;
+        std::size_t end = start;
+        while (end < m_text.size())
+        {
+            const std::uint8_t charClass = c_charClasses[static_cast<unsigned char>(m_text[end])];
+            if (charClass & Special)
+            {
+                break;
+            }
+
+            if (charClass & Alnum)
+            {
+                state.lookBehind = DelimiterType::Alphanumeric;
+            }
+            else if (charClass & Space)
+            {
+                state.lookBehind = DelimiterType::WhiteSpace;
+            }
+            else if (charClass & Punct)
+            {
+                state.lookBehind = DelimiterType::Puntuation;
+            }
+            ++end;
+        }
+
+        AppendEscaped(m_text.substr(start, end - start));
+        m_position = end;
+    }
+
+    void MarkDownTokenizer::UpdateLookBehind(EmphasisParserState& state, int ch)
+    {
+        if (IsCharClass(ch, Alnum))
+        {
+            state.lookBehind = DelimiterType::Alphanumeric;
+        }
+        else if (IsCharClass(ch, Space))
+        {
+            state.lookBehind = DelimiterType::WhiteSpace;
+        }
+        else if (IsCharClass(ch, Punct))
+        {
+            state.lookBehind = (ch == '\\') ? DelimiterType::Escape : DelimiterType::Puntuation;
+        }
+    }
+
+    void MarkDownTokenizer::UpdateCurrentEmphasisRunState(EmphasisParserState& state, DelimiterType emphasisType)
+    {
+        if (state.lookBehind != DelimiterType::WhiteSpace)
+        {
+            state.checkLookAhead = (state.lookBehind == DelimiterType::Puntuation);
+            state.checkIntraWord = (state.lookBehind == DelimiterType::Alphanumeric && emphasisType == DelimiterType::Underscore);
+        }
+        ++state.delimiterCount;
+        state.delimiterType = emphasisType;
+    }
+
+    bool MarkDownTokenizer::IsLeftEmphasisDelimiter(const EmphasisParserState& state, int ch)
+    {
+        if (state.delimiterCount && ch != EOF)
+        {
+            return !IsCharClass(ch, Space) && !(state.lookBehind == DelimiterType::Alphanumeric && IsCharClass(ch, Punct)) &&
+                !(state.lookBehind == DelimiterType::Alphanumeric && state.delimiterType == DelimiterType::Underscore);
+        }
+        return false;
+    }
+
+    bool MarkDownTokenizer::IsRightEmphasisDelimiter(const EmphasisParserState& state, int ch)
+    {
+        if ((ch == EOF || IsCharClass(ch, Space)) && (state.lookBehind != DelimiterType::WhiteSpace) &&
+            (state.checkLookAhead || state.checkIntraWord || state.delimiterType == DelimiterType::Asterisk))
+        {
+            return true;
+        }
+
+        if (IsCharClass(ch, Alnum) && state.lookBehind != DelimiterType::WhiteSpace && state.lookBehind != DelimiterType::Init)
+        {
+            return !state.checkLookAhead && !state.checkIntraWord;
+        }
+
+        return IsCharClass(ch, Punct) && state.lookBehind != DelimiterType::WhiteSpace;
+    }
+
+    void MarkDownTokenizer::CaptureText(MarkDownTokenList& tokens, EmphasisParserState& state, std::size_t sourceEnd)
+    {
+        if (m_arena.size() != state.tokenOffset)
+        {
+            AppendToTokens(tokens, AddToken(MarkDownTokenType::Text, state.tokenOffset, state.sourceOffset, sourceEnd - state.sourceOffset));
+            state.tokenOffset = m_arena.size();
+            state.sourceOffset = sourceEnd;
+        }
+    }
+
+    void MarkDownTokenizer::CaptureEmphasis(MarkDownTokenList& tokens, EmphasisParserState& state, int ch)
+    {
+        MarkDownTokenType type;
+        if (IsRightEmphasisDelimiter(state, ch))
+        {
+            // right emphasis can be also left emphasis
+            type = IsLeftEmphasisDelimiter(state, ch) ? MarkDownTokenType::LeftAndRightEmphasis : MarkDownTokenType::RightEmphasis;
+        }
+        else if (IsLeftEmphasisDelimiter(state, ch))
+        {
+            type = MarkDownTokenType::LeftEmphasis;
+        }
+        else
+        {
+            // no valid emphasis delimiter runs found, treat them as regular string tokens
+            CaptureText(tokens, state, m_position);
+            return;
+        }
+
+        const int token = AddToken(type, state.tokenOffset, state.sourceOffset, m_position - state.sourceOffset);
+        m_tokens[token].delimiterType = state.delimiterType;
+        m_tokens[token].unusedDelimiters = state.delimiterCount;
+        AppendToLookUpTable(tokens, token);
+        AppendToTokens(tokens, token);
+        state.tokenOffset = m_arena.size();
+        state.sourceOffset = m_position;
+    }
+
+    // link is in form of [txt](url); see LinkParser for each stage of the syntax check
+    void MarkDownTokenizer::MatchLink(MarkDownTokenList& tokens)
+    {
+        // holds intermediate result of link text
+        MarkDownTokenList linkText;
+
+        if (Peek() != '[')
+        {
+            return;
+        }
+        AddCharToken(linkText, Get());
+
+        if (Peek() == ']')
+        {
+            AddCharToken(linkText, Get());
+        }
+        else
+        {
+            // parses recursively to the right
+            while (Peek() != EOF && Peek() != ']')
+            {
+                ParseBlock(tokens);
+                AppendTokenList(linkText, tokens);
+
+                if (linkText.isCaptured)
+                {
+                    break;
+                }
+            }
+
+            if (Peek() != ']')
+            {
+                AppendTokenList(tokens, linkText);
+                return;
+            }
+            AddCharToken(linkText, Get());
+        }
+
+        if (Peek() != '(')
+        {
+            AppendTokenList(tokens, linkText);
+            return;
+        }
+        AddCharToken(linkText, Get());
+
+        // the text ending here isn't a match either; LinkParser used to drop the link text in this case
+        if (Peek() == EOF || IsCharClass(Peek(), Cntrl))
+        {
+            AppendTokenList(tokens, linkText);
+            return;
+        }
+
+        if (Peek() == ')')
+        {
+            Get();
+        }
+        else
+        {
+            // parses destination
+            ParseBlock(tokens);
+            if (Peek() != ')')
+            {
+                AppendTokenList(tokens, linkText);
+                return;
+            }
+        }
+
+        if (IsCharClass(Peek(), Space | Cntrl))
+        {
+            AppendTokenList(tokens, linkText);
+            return;
+        }
+
+        if (Peek() == ')')
+        {
+            Get();
+        }
+        else
+        {
+            ParseBlock(tokens);
+        }
+
+        CaptureLink(tokens, linkText);
+    }
+
+    // a link token, written as <a href="destination">text</a>, replaces what was parsed
+    void MarkDownTokenizer::CaptureLink(MarkDownTokenList& tokens, MarkDownTokenList& linkText)
+    {
+        // '[', ']' and '(' aren't part of the link text
+        PopFront(linkText);
+        PopBack(linkText);
+        PopBack(linkText);
+
+        MatchLeftAndRightEmphasises(linkText, m_tags);
+
+        const int token = AddToken(MarkDownTokenType::Link, m_arena.size(), 0, 0);
+        m_tokens[token].firstChild = linkText.front;
+        m_tokens[token].destination = tokens.front;
+
+        Clear(tokens);
+        tokens.hasHtmlTags = true;
+        AppendToTokens(tokens, token);
+        tokens.isCaptured = true;
+    }
+
+    // list marker has a form of ^-\s+ or [\r, \n]-\s+
+    void MarkDownTokenizer::MatchList(MarkDownTokenList& tokens)
+    {
+        const int ch = Peek();
+        if (!IsListMarker(ch))
+        {
+            return;
+        }
+
+        Get();
+        if (CompleteListParsing(tokens))
+        {
+            CaptureListItem(tokens, MarkDownTokenType::ListItem, 0, 0);
+        }
+        else if (ch == '*')
+        {
+            // put the char back and start emphasis parsing
+            Unget();
+            ParseTextAndEmphasis(tokens);
+        }
+        else
+        {
+            AddCharToken(tokens, ch);
+        }
+    }
+
+    // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*
+    void MarkDownTokenizer::MatchOrderedList(MarkDownTokenList& tokens)
+    {
+        if (!IsCharClass(Peek(), Digit))
+        {
+            return;
+        }
+
+        const std::size_t textOffset = m_arena.size();
+        const std::size_t numberOffset = m_position;
+        do
+        {
+            m_arena += static_cast<char>(Get());
+        } while (IsCharClass(Peek(), Digit));
+        const std::size_t numberLength = m_position - numberOffset;
+
+        if (Peek() == '.')
+        {
+            Get();
+            if (CompleteListParsing(tokens))
+            {
+                CaptureListItem(tokens, MarkDownTokenType::OrderedListItem, numberOffset, numberLength);
+                return;
+            }
+            // nothing has been added to the arena since the number
+            m_arena += '.';
+        }
+        AppendToTokens(tokens, AddToken(MarkDownTokenType::Text, textOffset, numberOffset, m_position - numberOffset));
+    }
+
+    bool MarkDownTokenizer::CompleteListParsing(MarkDownTokenList& tokens)
+    {
+        if (Peek() != ' ')
+        {
+            return false;
+        }
+
+        // any other spaces are ignored
+        do
+        {
+            Get();
+        } while (Peek() == ' ');
+
+        ParseBlock(tokens);
+        ParseSubBlocks(tokens);
+        return true;
+    }
+
+    // parses the rest of a list item, up to the start of a new list item or block
+    void MarkDownTokenizer::ParseSubBlocks(MarkDownTokenList& tokens)
+    {
+        while (!m_eof)
+        {
+            if (IsNewLine(Peek()))
+            {
+                const std::size_t newLineOffset = m_position;
+                const int newLine = Get();
+                if (IsCharClass(Peek(), Digit))
+                {
+                    const std::size_t textOffset = m_arena.size();
+                    if (MatchNewOrderedListItem())
+                    {
+                        break;
+                    }
+                    AppendToTokens(tokens, AddToken(MarkDownTokenType::Text, textOffset, newLineOffset + 1, m_position - newLineOffset - 1));
+                }
+                else if (MatchNewListItem() || MatchNewBlock())
+                {
+                    break;
+                }
+
+                AddCharToken(tokens, newLine, newLineOffset);
+            }
+            ParseBlock(tokens);
+        }
+    }
+
+    bool MarkDownTokenizer::MatchNewListItem()
+    {
+        if (IsListMarker(Peek()))
+        {
+            Get();
+            const bool isListItem = (Peek() == ' ');
+            Unget();
+            return isListItem;
+        }
+        return false;
+    }
+
+    // lines separated by more than one new line are new blocks
+    bool MarkDownTokenizer::MatchNewBlock()
+    {
+        if (IsNewLine(Peek()))
+        {
+            do
+            {
+                Get();
+            } while (IsNewLine(Peek()));
+            return true;
+        }
+        return false;
+    }
+
+    // matches \d+\. leaving the last digit to be parsed again, as ListParser does; the digits go to the text arena
+    bool MarkDownTokenizer::MatchNewOrderedListItem()
+    {
+        do
+        {
+            m_arena += static_cast<char>(Get());
+        } while (IsCharClass(Peek(), Digit));
+
+        if (Peek() == '.')
+        {
+            Unget();
+            return true;
+        }
+        return false;
+    }
+
+    // a list item token, written as <li>content</li>, replaces what was parsed
+    void MarkDownTokenizer::CaptureListItem(MarkDownTokenList& tokens, MarkDownTokenType type, std::size_t numberOffset, std::size_t numberLength)
+    {
+        MatchLeftAndRightEmphasises(tokens, m_tags);
+
+        const int token = AddToken(type, m_arena.size(), 0, 0);
+        m_tokens[token].numberOffset = numberOffset;
+        m_tokens[token].numberLength = numberLength;
+        m_tokens[token].firstChild = tokens.front;
+
+        Clear(tokens);
+        tokens.hasHtmlTags = true;
+        AppendToTokens(tokens, token);
+    }
+}
+
 MarkDownParser::MarkDownParser(const std::string& txt) : m_text(txt), m_hasHTMLTag(false), m_isEscaped(false)
 {
 }
@@ -19,18 +1978,24 @@ std::string MarkDownParser::TransformToHtml()
     {
         return "<p></p>";
     }
-    // begin parsing html blocks
-    ParseBlock();
 
-    // process further what is parsed before outputting
-    // html string
-    m_parsedResult.Translate();
+    m_isEscaped = (m_text.find_first_of("<>\"&") != std::string::npos);
+
+    std::string html;
+    MarkDownTokenizer tokenizer(m_text);
+    m_hasHTMLTag = tokenizer.TransformToHtml(html);
+    return html;
+}
 
-    // add block tags such as <p> <ul>
-    m_parsedResult.AddBlockTags();
+// transforms string to styled runs of it
+std::vector<MarkDownRun> MarkDownParser::TransformToRuns()
+{
+    std::vector<MarkDownRun> runs;
+    m_isEscaped = (m_text.find_first_of("<>\"&") != std::string::npos);
 
-    m_hasHTMLTag = m_parsedResult.HasHtmlTags();
-    return m_parsedResult.GenerateHtmlString();
+    MarkDownTokenizer tokenizer(m_text);
+    m_hasHTMLTag = tokenizer.TransformToRuns(runs);
+    return runs;
 }
 
 bool MarkDownParser::HasHtmlTags()
@@ -48,47 +2013,40 @@ std::string MarkDownParser::GetRawText() const
     return m_text;
 }
 
-// MarkDown is consisted of Blocks, this methods parses blocks
-void MarkDownParser::ParseBlock()
+IncrementalMarkDownParser::IncrementalMarkDownParser() :
+    m_html("<p></p>"), m_tokenizer(std::make_unique<MarkDownTokenizer>(std::string_view())), m_hasHTMLTag(false), m_isEscaped(false)
 {
-    std::stringstream stream(EscapeText());
-    EmphasisParser parser;
-    while (!stream.eof())
-    {
-        parser.ParseBlock(stream);
-    }
-    m_parsedResult.AppendParseResult(parser.GetParsedResult());
 }
 
-std::string MarkDownParser::EscapeText()
+IncrementalMarkDownParser::~IncrementalMarkDownParser() = default;
+
+// parses on from where the text appended can't change what was parsed before
+std::size_t IncrementalMarkDownParser::AppendText(const std::string& text)
 {
-    std::string escaped;
-    unsigned int nonEscapedCounts = 0;
+    m_text += text;
+    m_isEscaped = m_isEscaped || (text.find_first_of("<>\"&") != std::string::npos);
 
-    for (std::string::size_type i = 0; i < m_text.length(); i++)
-    {
-        switch (m_text.at(i))
-        {
-        case '<':
-            escaped += "&lt;";
-            break;
-        case '>':
-            escaped += "&gt;";
-            break;
-        case '"':
-            escaped += "&quot;";
-            break;
-        case '&':
-            escaped += "&amp;";
-            break;
-        default:
-            escaped += m_text.at(i);
-            nonEscapedCounts++;
-            break;
-        }
-    }
+    std::size_t unchangedSize = 0;
+    m_hasHTMLTag = m_tokenizer->TransformAppendedToHtml(m_text, m_html, unchangedSize);
+    return unchangedSize;
+}
+
+const std::string& IncrementalMarkDownParser::GetHtml() const
+{
+    return m_html;
+}
+
+bool IncrementalMarkDownParser::HasHtmlTags() const
+{
+    return m_hasHTMLTag;
+}
 
-    m_isEscaped = (nonEscapedCounts != m_text.length());
+bool IncrementalMarkDownParser::IsEscaped() const
+{
+    return m_isEscaped;
+}
 
-    return escaped;
+std::string IncrementalMarkDownParser::GetRawText() const
+{
+    return m_text;
 }
@@ -10,6 +10,35 @@
 
 namespace AdaptiveCards
 {
+    // The block a MarkDownRun is part of, as TransformToHtml writes it in <p>, <ul> or <ol>
+    enum class MarkDownBlockType
+    {
+        Paragraph,
+        BulletedListItem,
+        NumberedListItem
+    };
+
+    // A range of the text with the style markdown gives it, for hosts that build native text rather than import the
+    // html. Offsets are into the text given to the parser (GetRawText), which is not html escaped; markup such as
+    // delimiters, brackets, list markers and escape chars isn't part of any run. A list item nested in another list item
+    // or in a link is a list item of its own, after the text before it.
+    struct MarkDownRun
+    {
+        std::size_t textOffset;
+        std::size_t textLength;
+        MarkDownBlockType blockType;
+        // the first run of a paragraph or list item; a paragraph or list item without text has one empty run
+        bool isBlockStart;
+        bool isBold;
+        bool isItalic;
+        bool isLink;
+        // the destination of the link, as the href TransformToHtml writes (not html escaped)
+        std::string link;
+        // the number a numbered list starts at, as written
+        std::size_t listStartOffset;
+        std::size_t listStartLength;
+    };
+
     class MarkDownParser
     {
     public:
@@ -17,6 +46,9 @@ namespace AdaptiveCards
 
         std::string TransformToHtml();
 
+        // the text and styles TransformToHtml would generate html for, in the same order
+        std::vector<MarkDownRun> TransformToRuns();
+
         std::string GetRawText() const;
 
         bool HasHtmlTags();
@@ -24,10 +56,46 @@ namespace AdaptiveCards
         bool IsEscaped() const;
 
     private:
-        void ParseBlock();
-        std::string EscapeText();
         std::string m_text;
-        MarkDownParsedResult m_parsedResult;
+        bool m_hasHTMLTag;
+        bool m_isEscaped;
+    };
+
+    class MarkDownTokenizer;
+
+    // Transforms text that is appended to over time, such as a message streamed in, to the html
+    // MarkDownParser::TransformToHtml generates for all of it. Parsing carries on from the last point the appended text
+    // can't change, and only the html from the first token that may still change is written again. Text after a '['
+    // is parsed on as if no link followed, and parsed again from the '[' if a ']' turns up. Text in a link past its ']'
+    // or in a list item that hasn't ended yet is parsed again with each append.
+    class IncrementalMarkDownParser
+    {
+    public:
+        IncrementalMarkDownParser();
+        ~IncrementalMarkDownParser();
+
+        IncrementalMarkDownParser(const IncrementalMarkDownParser&) = delete;
+        IncrementalMarkDownParser(IncrementalMarkDownParser&&) = delete;
+        IncrementalMarkDownParser& operator=(const IncrementalMarkDownParser&) = delete;
+        IncrementalMarkDownParser& operator=(IncrementalMarkDownParser&&) = delete;
+
+        // Appends to the text and transforms it, and returns the size of the start of the html that is the same as
+        // before; hosts rendering the html as it comes only need to update what follows
+        std::size_t AppendText(const std::string& text);
+
+        // the html of all the text appended so far
+        const std::string& GetHtml() const;
+
+        std::string GetRawText() const;
+
+        bool HasHtmlTags() const;
+
+        bool IsEscaped() const;
+
+    private:
+        std::string m_text;
+        std::string m_html;
+        std::unique_ptr<MarkDownTokenizer> m_tokenizer;
         bool m_hasHTMLTag;
         bool m_isEscaped;
     };
@@ -63,9 +63,12 @@ std::vector<std::shared_ptr<MediaSource>>& Media::GetSources()
 
 void Media::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Poster,
+                                          AdaptiveCardSchemaKey::AltText,
+                                          AdaptiveCardSchemaKey::Sources});
+    SetKnownProperties(knownProperties);
 }
 
 void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
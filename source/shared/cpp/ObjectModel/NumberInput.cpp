@@ -101,8 +101,11 @@ std::shared_ptr<BaseCardElement> NumberInputParser::DeserializeFromString(ParseC
 
 void NumberInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Placeholder,
+                                          AdaptiveCardSchemaKey::Value,
+                                          AdaptiveCardSchemaKey::Max,
+                                          AdaptiveCardSchemaKey::Min});
+    SetKnownProperties(knownProperties);
 }
@@ -47,5 +47,8 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(Pa
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Url});
+    SetKnownProperties(knownProperties);
 }
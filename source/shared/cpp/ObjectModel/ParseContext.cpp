@@ -167,10 +167,15 @@ namespace AdaptiveCards
         if (!elementId.empty())
         {
             bool haveCollision = false;
-            const auto& nearestFallbackId = GetNearestFallbackId(elementInternalId);
+
+            // -1 is the last item on the stack (the one we're about to pop)
+            // -2 is the parent of the last item on the stack (if we're not looking at a toplevel element)
+            const AdaptiveCards::InternalId* parentInternalId =
+                (m_idStack.size() > 1) ? &std::get<TupleIndex::InternalId>(m_idStack[m_idStack.size() - 2]) : nullptr;
 
             // Walk through the list of elements we've seen with this ID
-            for (auto currentEntry = m_elementIds.find(elementId); currentEntry != m_elementIds.end(); ++currentEntry)
+            const auto entries = m_elementIds.equal_range(elementId);
+            for (auto currentEntry = entries.first; currentEntry != entries.second; ++currentEntry)
             {
                 const AdaptiveCards::InternalId& entryFallbackId = currentEntry->second;
 
@@ -184,20 +189,10 @@ namespace AdaptiveCards
 
                 // The inverse of the above -- if this element's fallback parent is the entry we're looking at, there's
                 // no collision.
-                try
-                {
-                    // -1 is the last item on the stack (the one we're about to pop)
-                    // -2 is the parent of the last item on the stack
-                    const auto& previousInStack = m_idStack.at(m_idStack.size() - 2);
-                    if (std::get<TupleIndex::InternalId>(previousInStack) == entryFallbackId)
-                    {
-                        // we're looking at a fallback entry for our parent
-                        break;
-                    }
-                }
-                catch (const std::out_of_range&)
+                if (parentInternalId != nullptr && *parentInternalId == entryFallbackId)
                 {
-                    // we're looking at a toplevel element
+                    // we're looking at a fallback entry for our parent
+                    break;
                 }
 
                 // if the element we're inspecting is fallback content, continue on to the next entry
@@ -218,7 +213,7 @@ namespace AdaptiveCards
             // no need to add an entry for this element if it's fallback (we'll add one when we parse it for non-fallback)
             if (!isFallback)
             {
-                m_elementIds.emplace(std::make_pair(elementId, nearestFallbackId));
+                m_elementIds.emplace(elementId, GetNearestFallbackId(elementInternalId));
             }
         }
 
@@ -43,6 +43,12 @@ namespace AdaptiveCards
         void PushBleedDirection(const ContainerBleedDirection direction);
         void PopBleedDirection();
 
+        // Whether properties the object model doesn't know about are kept in each element's additional properties, so
+        // that they survive a round trip through Serialize. Hosts that never serialize a parsed card can turn this off
+        // to skip the work. On by default.
+        bool GetCaptureAdditionalProperties() const { return m_captureAdditionalProperties; }
+        void SetCaptureAdditionalProperties(bool value) { m_captureAdditionalProperties = value; }
+
     private:
         const AdaptiveCards::InternalId GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const;
         // This enum is just a helper to keep track of the position of contents within the std::tuple used in
@@ -74,6 +80,7 @@ namespace AdaptiveCards
         std::vector<ContainerBleedDirection> m_parentalBleedDirection;
 
         bool m_canFallbackToAncestor;
+        bool m_captureAdditionalProperties{true};
         std::string m_language;
     };
 }
@@ -9,29 +9,261 @@
 #include "Container.h"
 #include "ShowCardAction.h"
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
 namespace
 {
-    Json::StreamWriterBuilder CreateJsonStreamWriter()
+    // Writes a Json::Value straight into a string, producing exactly what a Json::StreamWriter with no indentation and
+    // no comments would (17 significant digits for reals, members in sorted order), but without the ostream and the
+    // temporary strings jsoncpp builds for every token.
+    class JsonStringWriter
     {
-        Json::StreamWriterBuilder builder;
-        builder["commentStyle"] = "None";
-        builder["indentation"] = "";
+    public:
+        explicit JsonStringWriter(std::string& output) : m_output{output} {}
 
-        return builder;
-    }
+        void Write(const Json::Value& value)
+        {
+            switch (value.type())
+            {
+            case Json::nullValue:
+                m_output.append("null");
+                break;
+            case Json::intValue:
+                WriteNumber(value.asLargestInt());
+                break;
+            case Json::uintValue:
+                WriteNumber(value.asLargestUInt());
+                break;
+            case Json::realValue:
+                WriteReal(value.asDouble());
+                break;
+            case Json::stringValue:
+            {
+                const char* begin;
+                const char* end;
+                if (value.getString(&begin, &end))
+                {
+                    WriteQuoted(begin, end);
+                }
+                break;
+            }
+            case Json::booleanValue:
+                m_output.append(value.asBool() ? "true" : "false");
+                break;
+            case Json::arrayValue:
+            {
+                m_output.push_back('[');
+                const Json::ArrayIndex size = value.size();
+                for (Json::ArrayIndex i = 0; i < size; ++i)
+                {
+                    if (i != 0)
+                    {
+                        m_output.push_back(',');
+                    }
+                    Write(value[i]);
+                }
+                m_output.push_back(']');
+                break;
+            }
+            case Json::objectValue:
+            {
+                // members come out in the same (sorted) order as Json::Value::getMemberNames
+                m_output.push_back('{');
+                for (auto it = value.begin(); it != value.end(); ++it)
+                {
+                    if (it != value.begin())
+                    {
+                        m_output.push_back(',');
+                    }
+                    const char* end;
+                    const char* begin = it.memberName(&end);
+                    WriteQuoted(begin, end);
+                    m_output.push_back(':');
+                    Write(*it);
+                }
+                m_output.push_back('}');
+                break;
+            }
+            }
+        }
+
+    private:
+        template<typename T> void WriteNumber(T value)
+        {
+            char buffer[24];
+            const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+            m_output.append(buffer, result.ptr);
+        }
+
+        void WriteReal(double value)
+        {
+            if (!std::isfinite(value))
+            {
+                m_output.append((value != value) ? "null" : (value < 0) ? "-1e+9999" : "1e+9999");
+                return;
+            }
+
+            char buffer[36];
+            const int length = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+            std::replace(buffer, buffer + length, ',', '.');
+            m_output.append(buffer, length);
+            // like jsoncpp, keep reals recognizable as such
+            if (std::find_if(buffer, buffer + length, [](char c) { return c == '.' || c == 'e'; }) == buffer + length)
+            {
+                m_output.append(".0");
+            }
+        }
+
+        // jsoncpp's decoding, malformed sequences included, so that escapes come out the same
+        static unsigned int Utf8ToCodepoint(const char*& current, const char* end)
+        {
+            constexpr unsigned int replacementCharacter = 0xFFFD;
+            const unsigned int firstByte = static_cast<unsigned char>(*current);
+            if (firstByte < 0x80)
+            {
+                return firstByte;
+            }
+
+            if (firstByte < 0xE0)
+            {
+                if (end - current < 2)
+                {
+                    return replacementCharacter;
+                }
+                const unsigned int codepoint = ((firstByte & 0x1F) << 6) | (static_cast<unsigned int>(current[1]) & 0x3F);
+                current += 1;
+                return codepoint < 0x80 ? replacementCharacter : codepoint;
+            }
+
+            if (firstByte < 0xF0)
+            {
+                if (end - current < 3)
+                {
+                    return replacementCharacter;
+                }
+                const unsigned int codepoint = ((firstByte & 0x0F) << 12) | ((static_cast<unsigned int>(current[1]) & 0x3F) << 6) |
+                                               (static_cast<unsigned int>(current[2]) & 0x3F);
+                current += 2;
+                return (codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint < 0x800 ? replacementCharacter : codepoint;
+            }
+
+            if (firstByte < 0xF8)
+            {
+                if (end - current < 4)
+                {
+                    return replacementCharacter;
+                }
+                const unsigned int codepoint = ((firstByte & 0x07) << 24) | ((static_cast<unsigned int>(current[1]) & 0x3F) << 12) |
+                                               ((static_cast<unsigned int>(current[2]) & 0x3F) << 6) |
+                                               (static_cast<unsigned int>(current[3]) & 0x3F);
+                current += 3;
+                return codepoint < 0x10000 ? replacementCharacter : codepoint;
+            }
+
+            return replacementCharacter;
+        }
+
+        void WriteUnicodeEscape(unsigned int codeUnit)
+        {
+            constexpr char hexDigits[] = "0123456789abcdef";
+            const char escape[] = {'\\', 'u', hexDigits[(codeUnit >> 12) & 0xF], hexDigits[(codeUnit >> 8) & 0xF],
+                                   hexDigits[(codeUnit >> 4) & 0xF], hexDigits[codeUnit & 0xF]};
+            m_output.append(escape, sizeof(escape));
+        }
+
+        void WriteQuoted(const char* begin, const char* end)
+        {
+            m_output.push_back('"');
+            const char* runStart = begin;
+            for (const char* current = begin; current != end; ++current)
+            {
+                const auto c = static_cast<unsigned char>(*current);
+                if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\')
+                {
+                    // plain printable ASCII goes out in runs
+                    continue;
+                }
+
+                m_output.append(runStart, current);
+                switch (c)
+                {
+                case '"':
+                    m_output.append("\\\"");
+                    break;
+                case '\\':
+                    m_output.append("\\\\");
+                    break;
+                case '\b':
+                    m_output.append("\\b");
+                    break;
+                case '\f':
+                    m_output.append("\\f");
+                    break;
+                case '\n':
+                    m_output.append("\\n");
+                    break;
+                case '\r':
+                    m_output.append("\\r");
+                    break;
+                case '\t':
+                    m_output.append("\\t");
+                    break;
+                default:
+                {
+                    unsigned int codepoint = Utf8ToCodepoint(current, end);
+                    if (codepoint < 0x80 && codepoint >= 0x20)
+                    {
+                        m_output.push_back(static_cast<char>(codepoint));
+                    }
+                    else if (codepoint < 0x10000)
+                    {
+                        WriteUnicodeEscape(codepoint);
+                    }
+                    else
+                    {
+                        codepoint -= 0x10000;
+                        WriteUnicodeEscape((codepoint >> 10) + 0xD800);
+                        WriteUnicodeEscape((codepoint & 0x3FF) + 0xDC00);
+                    }
+                    break;
+                }
+                }
+                runStart = current + 1;
+            }
+            m_output.append(runStart, end);
+            m_output.push_back('"');
+        }
+
+        std::string& m_output;
+    };
 }
 
 namespace AdaptiveCards
 {
     std::string ParseUtil::JsonToString(const Json::Value& json)
     {
-        const thread_local Json::StreamWriterBuilder builder = ::CreateJsonStreamWriter();
-        std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+        // Written into a per-thread buffer that keeps its capacity, so the result is allocated once at its final size
+        // instead of growing as it's written. A buffer grown past c_maxRetainedJsonBufferSize by an unusually large
+        // value is handed to the caller rather than copied and kept.
+        constexpr size_t c_maxRetainedJsonBufferSize = 64 * 1024;
+        thread_local std::string buffer;
+        JsonToString(json, buffer);
+        if (buffer.capacity() > c_maxRetainedJsonBufferSize)
+        {
+            return std::exchange(buffer, std::string());
+        }
+        return buffer;
+    }
 
-        std::ostringstream outStream;
-        writer->write(json, &outStream);
-        outStream << std::endl;
-        return outStream.str();
+    void ParseUtil::JsonToString(const Json::Value& json, std::string& output)
+    {
+        output.clear();
+        JsonStringWriter(output).Write(json);
+        output.push_back('\n');
     }
 
     void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
@@ -42,21 +274,47 @@ namespace AdaptiveCards
         }
     }
 
+    namespace
+    {
+        // The item ParseUtil::ImpliedTypeScope currently implies a type for, if any
+        thread_local const Json::Value* t_impliedTypeJson{};
+        thread_local const std::string* t_impliedType{};
+    }
+
+    ParseUtil::ImpliedTypeScope::ImpliedTypeScope(const Json::Value& json, const std::string& impliedType) :
+        m_previousJson{t_impliedTypeJson}, m_previousImpliedType{t_impliedType}
+    {
+        t_impliedTypeJson = impliedType.empty() ? nullptr : &json;
+        t_impliedType = &impliedType;
+    }
+
+    ParseUtil::ImpliedTypeScope::~ImpliedTypeScope()
+    {
+        t_impliedTypeJson = m_previousJson;
+        t_impliedType = m_previousImpliedType;
+    }
+
     std::string ParseUtil::GetTypeAsString(const Json::Value& json)
     {
-        const char typeKey[] = "type";
+        if (&json == t_impliedTypeJson)
+        {
+            // the same test GetElementCollection checks the item's type with, so a null or empty type is implied too
+            return GetString(json, AdaptiveCardSchemaKey::Type, *t_impliedType, false);
+        }
+
+        const Json::Value* typeValue = FindProperty(json, AdaptiveCardSchemaKey::Type);
 
-        if (!json.isMember(typeKey))
+        if (typeValue == nullptr)
         {
             std::stringstream ss;
 
             ss << "The JSON element is missing the following value: ";
-            ss << typeKey;
+            ss << AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type);
 
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, ss.str());
         }
 
-        return json.get(typeKey, Json::Value()).asString();
+        return typeValue->asString();
     }
 
     std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
@@ -71,6 +329,12 @@ namespace AdaptiveCards
         }
     }
 
+    const Json::Value* ParseUtil::FindProperty(const Json::Value& json, AdaptiveCardSchemaKey key)
+    {
+        const std::string_view propertyName = AdaptiveCardSchemaKeyToStringView(key);
+        return json.find(propertyName.data(), propertyName.data() + propertyName.size());
+    }
+
     std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaKey key)
     {
         try
@@ -86,14 +350,13 @@ namespace AdaptiveCards
     // Get value mapped to key. Validates that value is string JSON type.
     std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             if (isRequired)
             {
                 throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
+                                                 "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
             }
             else
             {
@@ -101,13 +364,13 @@ namespace AdaptiveCards
             }
         }
 
-        if (!propertyValue.isString())
+        if (!propertyValue->isString())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type string.");
+                                             "Value for property " + AdaptiveCardSchemaKeyToString(key) + " was invalid. Expected type string.");
         }
 
-        return propertyValue.asString();
+        return propertyValue->asString();
     }
 
     std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, const std::string& defaultValue, bool isRequired)
@@ -124,14 +387,13 @@ namespace AdaptiveCards
 
     std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             if (isRequired)
             {
                 throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
+                                                 "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
             }
             else
             {
@@ -139,20 +401,19 @@ namespace AdaptiveCards
             }
         }
 
-        return propertyValue.toStyledString();
+        return propertyValue->toStyledString();
     }
 
     // Get value mapped to key as a string, regardless of value's JSON type.
     std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             if (isRequired)
             {
                 throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
+                                                 "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
             }
             else
             {
@@ -160,7 +421,7 @@ namespace AdaptiveCards
             }
         }
 
-        return propertyValue.asString();
+        return propertyValue->asString();
     }
 
     [[deprecated("Use generalized DeserializeValue<T> instead")]] std::shared_ptr<BackgroundImage>
@@ -187,32 +448,30 @@ namespace AdaptiveCards
     // Get optional boolean value at given key. Validates that value is bool type, if present.
     std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, AdaptiveCardSchemaKey key)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             return std::nullopt;
         }
 
-        if (!propertyValue.isBool())
+        if (!propertyValue->isBool())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type bool.");
+                                             "Value for property " + AdaptiveCardSchemaKeyToString(key) + " was invalid. Expected type bool.");
         }
 
-        return propertyValue.asBool();
+        return propertyValue->asBool();
     }
 
     unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             if (isRequired)
             {
                 throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
+                                                 "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
             }
             else
             {
@@ -220,13 +479,13 @@ namespace AdaptiveCards
             }
         }
 
-        if (!propertyValue.isUInt())
+        if (!propertyValue->isUInt())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type uInt.");
+                                             "Value for property " + AdaptiveCardSchemaKeyToString(key) + " was invalid. Expected type uInt.");
         }
 
-        return propertyValue.asUInt();
+        return propertyValue->asUInt();
     }
 
     int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int defaultValue, bool isRequired)
@@ -246,38 +505,36 @@ namespace AdaptiveCards
 
     std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCardSchemaKey key)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             return std::nullopt;
         }
 
-        if (!propertyValue.isInt())
+        if (!propertyValue->isInt())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type int.");
+                                             "Value for property " + AdaptiveCardSchemaKeyToString(key) + " was invalid. Expected type int.");
         }
 
-        return propertyValue.asInt();
+        return propertyValue->asInt();
     }
 
     std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             return std::nullopt;
         }
 
-        if (!propertyValue.isDouble())
+        if (!propertyValue->isDouble())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type double.");
+                                             "Value for property " + AdaptiveCardSchemaKeyToString(key) + " was invalid. Expected type double.");
         }
 
-        return propertyValue.asDouble();
+        return propertyValue->asDouble();
     }
 
     void ParseUtil::ExpectTypeString(const Json::Value& json, const std::string& expectedTypeStr)
@@ -317,29 +574,28 @@ namespace AdaptiveCards
         throwIfWrongType(value);
     }
 
-    Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    const Json::Value& ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto elementArray = json.get(propertyName, Json::Value());
+        const Json::Value* elementArray = FindProperty(json, key);
 
-        if (!elementArray.isNull() && !elementArray.isArray())
+        if (elementArray != nullptr && !elementArray->isNull() && !elementArray->isArray())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Could not parse specified key: " + propertyName + ". It was not an array");
+                                             "Could not parse specified key: " + AdaptiveCardSchemaKeyToString(key) + ". It was not an array");
         }
 
-        if (isRequired && elementArray.empty())
+        if (isRequired && (elementArray == nullptr || elementArray->empty()))
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                             "Could not parse required key: " + propertyName + ". It was not found");
+                                             "Could not parse required key: " + AdaptiveCardSchemaKeyToString(key) + ". It was not found");
         }
 
-        return elementArray;
+        return elementArray != nullptr ? *elementArray : Json::Value::nullSingleton();
     }
 
     std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        auto jsonArray = ParseUtil::GetArray(json, key, isRequired);
+        const auto& jsonArray = ParseUtil::GetArray(json, key, isRequired);
         std::vector<std::string> strings;
 
         strings.reserve(jsonArray.size());
@@ -354,8 +610,8 @@ namespace AdaptiveCards
 
     Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
     {
-        const thread_local Json::CharReaderBuilder readerBuilder;
-        std::unique_ptr<Json::CharReader> reader(readerBuilder.newCharReader());
+        // The reader is kept per thread and reused, rather than set up again for every string parsed
+        thread_local const std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 
         Json::Value jsonValue;
         std::string errors;
@@ -371,14 +627,13 @@ namespace AdaptiveCards
 
     Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (isRequired && propertyValue.empty())
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (isRequired && (propertyValue == nullptr || propertyValue->empty()))
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                             "Could not extract required key: " + propertyName + ".");
+                                             "Could not extract required key: " + AdaptiveCardSchemaKeyToString(key) + ".");
         }
-        return propertyValue;
+        return propertyValue != nullptr ? *propertyValue : Json::Value();
     }
 
     std::string ParseUtil::ToLowercase(std::string const& value)
@@ -391,6 +646,77 @@ namespace AdaptiveCards
         return new_value;
     }
 
+    namespace
+    {
+        // Value of each hex digit character, -1 for anything else
+        constexpr std::array<std::int8_t, 256> MakeHexDigitTable()
+        {
+            std::array<std::int8_t, 256> table{};
+            for (auto& value : table)
+            {
+                value = -1;
+            }
+            for (int i = 0; i < 10; ++i)
+            {
+                table['0' + i] = static_cast<std::int8_t>(i);
+            }
+            for (int i = 0; i < 6; ++i)
+            {
+                table['a' + i] = static_cast<std::int8_t>(10 + i);
+                table['A' + i] = static_cast<std::int8_t>(10 + i);
+            }
+            return table;
+        }
+
+        constexpr std::array<std::int8_t, 256> c_hexDigitValues = MakeHexDigitTable();
+    }
+
+    std::optional<std::uint32_t> ParseUtil::TryParseColor(const std::string& color)
+    {
+        const size_t length = color.length();
+        if ((length != 7 && length != 9) || color[0] != '#')
+        {
+            return std::nullopt;
+        }
+
+        // A table lookup rather than branching on the kind of digit, which is unpredictable for real colors. Invalid
+        // digits set the sign bit of `invalid` and are checked for once at the end.
+        std::uint32_t argb = 0;
+        int invalid = 0;
+        for (size_t i = 1; i < length; ++i)
+        {
+            const int nibble = c_hexDigitValues[static_cast<unsigned char>(color[i])];
+            invalid |= nibble;
+            argb = (argb << 4) | static_cast<std::uint32_t>(nibble & 0xF);
+        }
+
+        if (invalid < 0)
+        {
+            return std::nullopt;
+        }
+
+        return (length == 7) ? (0xFF000000 | argb) : argb;
+    }
+
+    std::unordered_set<std::string> ParseUtil::ExtendKnownProperties(const std::unordered_set<std::string>& baseProperties,
+                                                                     std::initializer_list<AdaptiveCardSchemaKey> keys)
+    {
+        std::unordered_set<std::string> knownProperties{baseProperties};
+        for (const auto key : keys)
+        {
+            knownProperties.insert(AdaptiveCardSchemaKeyToString(key));
+        }
+        return knownProperties;
+    }
+
+    std::unordered_set<std::string> ParseUtil::ExtendKnownProperties(const std::unordered_set<std::string>& baseProperties,
+                                                                     std::initializer_list<std::string> names)
+    {
+        std::unordered_set<std::string> knownProperties{baseProperties};
+        knownProperties.insert(names);
+        return knownProperties;
+    }
+
     std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContext& context, const Json::Value& json)
     {
         if (json.empty() || !json.isObject())
@@ -422,7 +748,7 @@ namespace AdaptiveCards
                                                                                    AdaptiveCardSchemaKey key,
                                                                                    bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArray(json, key, isRequired);
 
         std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -18,13 +18,22 @@ namespace AdaptiveCards
     namespace ParseUtil
     {
         std::string JsonToString(const Json::Value& json);
+        // Same as above, writing into `output` so that its buffer can be reused across calls
+        void JsonToString(const Json::Value& json, std::string& output);
 
         void ThrowIfNotJsonObject(const Json::Value& json);
 
+        // Also returns the type of an item of a collection whose items all share one type (e.g. the columns of a
+        // ColumnSet) when the item's JSON leaves it out or leaves it null or empty, while GetElementCollection parses
+        // that item
         std::string GetTypeAsString(const Json::Value& json);
 
         std::string TryGetTypeAsString(const Json::Value& json);
 
+        // Looks up key in json with a single probe of its member map, copying neither the key name nor the value.
+        // Returns nullptr if the property isn't present. Throws Json::LogicError if json is neither an object nor null.
+        const Json::Value* FindProperty(const Json::Value& json, AdaptiveCardSchemaKey key);
+
         std::string GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         std::string GetString(const Json::Value& json, AdaptiveCardSchemaKey key, const std::string& defaultValue, bool isRequired = false);
@@ -50,7 +59,7 @@ namespace AdaptiveCards
 
         std::optional<double> GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key);
 
-        Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+        const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         std::vector<std::string> GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
@@ -118,40 +127,80 @@ namespace AdaptiveCards
         void ExpectTypeString(const Json::Value& json, CardElementType bodyType);
         void ExpectTypeString(const Json::Value& json, const std::string& expectedTypeStr);
 
+        // Makes json's type read as impliedType (unless that's empty), if json's own "type" is missing, null or empty,
+        // for as long as the scope lasts. Only json itself is affected, not anything nested inside it; whatever was implied before is
+        // put back when the scope ends, on every path. This is kept per thread, so one parse must stay on one thread.
+        class ImpliedTypeScope
+        {
+        public:
+            ImpliedTypeScope(const Json::Value& json, const std::string& impliedType);
+            ~ImpliedTypeScope();
+
+            ImpliedTypeScope(const ImpliedTypeScope&) = delete;
+            ImpliedTypeScope& operator=(const ImpliedTypeScope&) = delete;
+
+        private:
+            const Json::Value* m_previousJson;
+            const std::string* m_previousImpliedType;
+        };
+
         // throws if the key is missing or the value mapped to the key is the wrong type
         void ExpectKeyAndValueType(const Json::Value& json, const char* expectedKey, std::function<void(const Json::Value&)> throwIfWrongType);
 
         std::string ToLowercase(const std::string& value);
 
+        // Parses a "#AARRGGBB" or "#RRGGBB" color into packed 0xAARRGGBB (alpha 0xFF for the latter). Returns an empty
+        // optional for anything else.
+        std::optional<std::uint32_t> TryParseColor(const std::string& color);
+
+        // Returns baseProperties plus the names of keys. Element types use this to build their known property set once,
+        // into a static shared by all of their instances.
+        std::unordered_set<std::string> ExtendKnownProperties(const std::unordered_set<std::string>& baseProperties,
+                                                              std::initializer_list<AdaptiveCardSchemaKey> keys);
+
+        // Returns baseProperties plus the given names, for element types a host adds properties of its own to
+        std::unordered_set<std::string> ExtendKnownProperties(const std::unordered_set<std::string>& baseProperties,
+                                                              std::initializer_list<std::string> names);
+
         std::shared_ptr<BaseCardElement> GetLabel(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key);
 
         std::shared_ptr<BaseCardElement> GetLabelFromJsonValue(ParseContext& context, const Json::Value& json);
     };
 
+    // enumConverter is either an ENUMTYPE##TryFromString function (takes std::string_view and returns std::optional,
+    // preferred) or an ENUMTYPE##FromString-style function that throws std::out_of_range for unknown values.
     template<typename T, typename Fn>
     std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter)
     {
-        std::string propertyValueStr = "";
-        try
+        const Json::Value* propertyValue = FindProperty(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
-            const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-            auto const& propertyValue = json.get(propertyName, Json::Value());
-            if (propertyValue.empty())
-            {
-                return std::nullopt;
-            }
+            return std::nullopt;
+        }
 
-            if (!propertyValue.isString())
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
-            }
+        if (!propertyValue->isString())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
+        }
 
-            propertyValueStr = propertyValue.asString();
-            return enumConverter(propertyValueStr);
+        if constexpr (std::is_invocable_v<Fn, std::string_view>)
+        {
+            // TryFromString converters read the value in place
+            const char* begin = nullptr;
+            const char* end = nullptr;
+            propertyValue->getString(&begin, &end);
+            return enumConverter(std::string_view{begin, static_cast<size_t>(end - begin)});
         }
-        catch (const std::out_of_range&)
+        else
         {
-            return std::nullopt;
+            try
+            {
+                return enumConverter(propertyValue->asString());
+            }
+            catch (const std::out_of_range&)
+            {
+                return std::nullopt;
+            }
         }
     }
 
@@ -210,7 +259,7 @@ namespace AdaptiveCards
         const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
         bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArray(json, key, isRequired);
 
         std::vector<std::shared_ptr<T>> elements;
         if (elementArray.empty())
@@ -275,7 +324,7 @@ namespace AdaptiveCards
                                                                     bool isRequired,
                                                                     const std::string& impliedType)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArray(json, key, isRequired);
 
         std::vector<std::shared_ptr<T>> elements;
         if (elementArray.empty())
@@ -289,7 +338,7 @@ namespace AdaptiveCards
         const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
 
         size_t currentIndex = 0;
-        for (auto& curJsonValue : elementArray)
+        for (const auto& curJsonValue : elementArray)
         {
             ContainerBleedDirection currentBleedState = previousBleedState;
 
@@ -313,7 +362,7 @@ namespace AdaptiveCards
             context.PushBleedDirection(currentBleedState);
 
             // If all items in this collection have the same implied type (i.e. Columns), verify
-            // that if set it is set correctly and set it if it isn't
+            // that if set it is set correctly and let the parser know about it if it isn't
             if (!impliedType.empty())
             {
                 const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
@@ -322,12 +371,13 @@ namespace AdaptiveCards
                     throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
                                                      "Unable to parse element of type " + typeString);
                 }
-
-                curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
             }
 
             std::shared_ptr<BaseElement> curElement;
-            ParseJsonObject<T>(context, curJsonValue, curElement);
+            {
+                const ImpliedTypeScope impliedTypeScope(curJsonValue, impliedType);
+                ParseJsonObject<T>(context, curJsonValue, curElement);
+            }
             elements.push_back(std::static_pointer_cast<T>(curElement));
 
             // restores the parent's bleed state
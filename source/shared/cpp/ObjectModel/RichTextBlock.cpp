@@ -65,7 +65,7 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::Deserialize(ParseContext&
 
     std::shared_ptr<RichTextBlock> richTextBlock = BaseCardElement::Deserialize<RichTextBlock>(context, json);
     richTextBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     auto inlines =
         ParseUtil::GetElementCollectionOfSingleType<Inline>(context, json, AdaptiveCardSchemaKey::Inlines, Inline::Deserialize, false);
@@ -81,6 +81,9 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
 
 void RichTextBlock::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::HorizontalAlignment,
+                                          AdaptiveCardSchemaKey::Inlines});
+    SetKnownProperties(knownProperties);
 }
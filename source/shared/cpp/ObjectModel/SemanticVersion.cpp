@@ -6,6 +6,28 @@
 
 using namespace AdaptiveCards;
 
+namespace
+{
+    // Reads the run of digits starting at `pos` into `part` and moves `pos` past it. Fails if there are no digits or
+    // the value doesn't fit in an int.
+    bool ParseVersionPart(const std::string& version, size_t& pos, unsigned int& part)
+    {
+        unsigned int value = 0;
+        const size_t start = pos;
+        for (; pos < version.length() && version[pos] >= '0' && version[pos] <= '9'; ++pos)
+        {
+            const unsigned int digit = version[pos] - '0';
+            if (value > (static_cast<unsigned int>(std::numeric_limits<int>::max()) - digit) / 10)
+            {
+                return false;
+            }
+            value = value * 10 + digit;
+        }
+        part = value;
+        return pos != start;
+    }
+}
+
 SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor(0), _build(0), _revision(0)
 {
     // valid:
@@ -19,49 +41,19 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // "1."
     // "F"
 
-    bool versionValid = false;
-#pragma warning(push)
-#pragma warning(disable : 26426)
-    // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
-    static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
-#pragma warning(pop)
-    std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
+    size_t pos = 0;
+    bool versionValid = ParseVersionPart(version, pos, _major);
+    for (unsigned int* part : {&_minor, &_build, &_revision})
     {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
-
-        try
-        {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
-
-            if (subMatches[2].matched)
-            {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
-            }
-
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
-
-            if (subMatches[4].matched)
-            {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
-            }
-        }
-        catch (const std::out_of_range&)
+        if (!versionValid || pos == version.length())
         {
-            versionValid = false;
+            break;
         }
+
+        // each further part is a '.' followed by digits
+        versionValid = (version[pos++] == '.') && ParseVersionPart(version, pos, *part);
     }
+    versionValid = versionValid && (pos == version.length());
 
     if (!versionValid)
     {
@@ -15,9 +15,9 @@ std::shared_ptr<Separator> Separator::Deserialize(const Json::Value& json)
     std::shared_ptr<Separator> separator = std::make_shared<Separator>();
 
     separator->SetColor(
-        ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColor::Default, ForegroundColorFromString));
+        ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColor::Default, ForegroundColorTryFromString));
     separator->SetThickness(ParseUtil::GetEnumValue<SeparatorThickness>(
-        json, AdaptiveCardSchemaKey::Thickness, SeparatorThickness::Default, SeparatorThicknessFromString));
+        json, AdaptiveCardSchemaKey::Thickness, SeparatorThickness::Default, SeparatorThicknessTryFromString));
 
     return separator;
 }
@@ -11,6 +11,10 @@
 #include "ParseContext.h"
 #include "BackgroundImage.h"
 
+#include <atomic>
+#include <system_error>
+#include <thread>
+
 using namespace AdaptiveCards;
 
 AdaptiveCard::AdaptiveCard() :
@@ -58,7 +62,7 @@ AdaptiveCard::AdaptiveCard(std::string const& version,
     m_version(version),
     m_fallbackText(fallbackText), m_backgroundImage(backgroundImage), m_speak(speak), m_style(style),
     m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height),
-    m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_additionalProperties{}
+    m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_knownProperties{}, m_additionalProperties{}
 {
     PopulateKnownPropertiesSet();
 }
@@ -107,7 +111,7 @@ AdaptiveCard::AdaptiveCard(std::string const& version,
     m_fallbackText(fallbackText), m_backgroundImage(backgroundImage), m_refresh(refresh),
     m_authentication(authentication), m_speak(speak), m_style(style), m_language(language),
     m_verticalContentAlignment(verticalContentAlignment), m_height(height),
-    m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_body(body), m_actions(actions), m_additionalProperties{}
+    m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_knownProperties{}, m_additionalProperties{}, m_body(body), m_actions(actions)
 {
     PopulateKnownPropertiesSet();
 }
@@ -202,7 +206,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         const SemanticVersion rendererMaxVersion(rendererVersion);
         const SemanticVersion cardVersion(version);
 
-        if (rendererVersion < cardVersion)
+        if (rendererMaxVersion < cardVersion)
         {
             if (fallbackText.empty())
             {
@@ -227,16 +231,16 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         ParseUtil::DeserializeValue<Authentication>(context, json, AdaptiveCardSchemaKey::Authentication, Authentication::Deserialize);
 
     ContainerStyle style =
-        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString);
+        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString);
     context.SetParentalContainerStyle(style);
 
     VerticalContentAlignment verticalContentAlignment =
         ParseUtil::GetEnumValue<VerticalContentAlignment>(json,
                                                           AdaptiveCardSchemaKey::VerticalContentAlignment,
                                                           VerticalContentAlignment::Top,
-                                                          VerticalContentAlignmentFromString);
+                                                          VerticalContentAlignmentTryFromString);
     HeightType height =
-        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString);
+        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString);
 
     unsigned int minHeight =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), &context.warnings).value_or(0);
@@ -256,9 +260,12 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     // Parse optional selectAction
     result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-    Json::Value additionalProperties;
-    HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
-    result->SetAdditionalProperties(additionalProperties);
+    if (context.GetCaptureAdditionalProperties())
+    {
+        Json::Value additionalProperties;
+        HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
+        result->SetAdditionalProperties(std::move(additionalProperties));
+    }
 
     return std::make_shared<ParseResult>(result, context.warnings);
 }
@@ -287,6 +294,85 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::stri
     return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
 }
 
+std::vector<std::shared_ptr<ParseResult>> AdaptiveCard::DeserializeBatch(const std::vector<std::string>& jsonStrings,
+                                                                        const std::string& rendererVersion,
+                                                                        std::shared_ptr<ElementParserRegistration> elementRegistration,
+                                                                        std::shared_ptr<ActionParserRegistration> actionRegistration,
+                                                                        std::vector<std::exception_ptr>* errors,
+                                                                        unsigned int maxThreads)
+{
+    // ParseContext would otherwise create a (default) registration per card
+    if (!elementRegistration)
+    {
+        elementRegistration = std::make_shared<ElementParserRegistration>();
+    }
+    if (!actionRegistration)
+    {
+        actionRegistration = std::make_shared<ActionParserRegistration>();
+    }
+
+    std::vector<std::shared_ptr<ParseResult>> results(jsonStrings.size());
+    std::vector<std::exception_ptr> failures(jsonStrings.size());
+
+    // Cards vary wildly in size, so rather than splitting the batch up front every worker claims the next unparsed
+    // card as soon as it's done with its previous one.
+    std::atomic<std::size_t> nextCard{0};
+    const auto parseCards = [&]() {
+        for (std::size_t i = nextCard.fetch_add(1, std::memory_order_relaxed); i < jsonStrings.size();
+             i = nextCard.fetch_add(1, std::memory_order_relaxed))
+        {
+            try
+            {
+                ParseContext context(elementRegistration, actionRegistration);
+                results[i] = AdaptiveCard::DeserializeFromString(jsonStrings[i], rendererVersion, context);
+            }
+            catch (...)
+            {
+                failures[i] = std::current_exception();
+            }
+        }
+    };
+
+    const unsigned int hardwareThreads = std::max(1U, std::thread::hardware_concurrency());
+    const auto threadCount = std::min<std::size_t>(maxThreads ? maxThreads : hardwareThreads, jsonStrings.size());
+
+    // the calling thread is the last worker
+    std::vector<std::thread> workers;
+    try
+    {
+        for (std::size_t i = 1; i < threadCount; ++i)
+        {
+            workers.emplace_back(parseCards);
+        }
+    }
+    catch (const std::system_error&)
+    {
+        // out of threads; carry on with the workers we have
+    }
+    parseCards();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (errors)
+    {
+        *errors = std::move(failures);
+    }
+    else
+    {
+        for (const auto& failure : failures)
+        {
+            if (failure)
+            {
+                std::rethrow_exception(failure);
+            }
+        }
+    }
+
+    return results;
+}
+
 Json::Value AdaptiveCard::SerializeToJsonValue() const
 {
     Json::Value root = GetAdditionalProperties();
@@ -553,27 +639,30 @@ void AdaptiveCard::SetRtl(const std::optional<bool>& value)
 
 void AdaptiveCard::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties({},
+                                         {AdaptiveCardSchemaKey::Type,
+                                          AdaptiveCardSchemaKey::Version,
+                                          AdaptiveCardSchemaKey::Body,
+                                          AdaptiveCardSchemaKey::Actions,
+                                          AdaptiveCardSchemaKey::FallbackText,
+                                          AdaptiveCardSchemaKey::BackgroundImage,
+                                          AdaptiveCardSchemaKey::Refresh,
+                                          AdaptiveCardSchemaKey::Authentication,
+                                          AdaptiveCardSchemaKey::MinHeight,
+                                          AdaptiveCardSchemaKey::Speak,
+                                          AdaptiveCardSchemaKey::Language,
+                                          AdaptiveCardSchemaKey::VerticalContentAlignment,
+                                          AdaptiveCardSchemaKey::Style,
+                                          AdaptiveCardSchemaKey::SelectAction,
+                                          AdaptiveCardSchemaKey::Height,
+                                          AdaptiveCardSchemaKey::Schema});
+    m_knownProperties = &knownProperties;
 }
 
 const std::unordered_set<std::string>& AdaptiveCard::GetKnownProperties() const
 {
-    return m_knownProperties;
+    return *m_knownProperties;
 }
 
 const Json::Value& AdaptiveCard::GetAdditionalProperties() const
@@ -156,6 +156,19 @@ namespace AdaptiveCards
                                                                   const std::string& speak);
 
 #endif // __ANDROID__
+
+        // Parses every card of jsonStrings on up to maxThreads threads (0 means one per hardware thread) and returns
+        // the results in input order. Each card gets its own ParseContext; the parser registrations are shared and
+        // must not be modified while the batch runs. When errors is null, the first failure in input order is
+        // rethrown once every card has been attempted. Otherwise errors receives one entry per card (null for cards
+        // that parsed) and the results of failed cards are null.
+        static std::vector<std::shared_ptr<ParseResult>> DeserializeBatch(const std::vector<std::string>& jsonStrings,
+                                                                          const std::string& rendererVersion,
+                                                                          std::shared_ptr<ElementParserRegistration> elementRegistration,
+                                                                          std::shared_ptr<ActionParserRegistration> actionRegistration,
+                                                                          std::vector<std::exception_ptr>* errors = nullptr,
+                                                                          unsigned int maxThreads = 0);
+
         Json::Value SerializeToJsonValue() const;
         std::string Serialize() const;
 
@@ -178,7 +191,7 @@ namespace AdaptiveCards
         unsigned int m_minHeight;
         std::optional<bool> m_rtl;
         InternalId m_internalId;
-        std::unordered_set<std::string> m_knownProperties;
+        const std::unordered_set<std::string>* m_knownProperties;
         Json::Value m_additionalProperties;
 
         std::vector<std::shared_ptr<BaseCardElement>> m_body;
@@ -64,7 +64,10 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(P
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Card});
+    SetKnownProperties(knownProperties);
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -16,13 +16,16 @@ namespace AdaptiveCards
 
     void Table::PopulateKnownPropertiesSet()
     {
-        m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+        static const std::unordered_set<std::string> knownProperties =
+            ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                             {AdaptiveCardSchemaKey::Columns,
+                                              AdaptiveCardSchemaKey::FirstRowAsHeaders,
+                                              AdaptiveCardSchemaKey::GridStyle,
+                                              AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+                                              AdaptiveCardSchemaKey::Rows,
+                                              AdaptiveCardSchemaKey::ShowGridLines,
+                                              AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+        SetKnownProperties(knownProperties);
     }
 
     bool Table::GetShowGridLines() const { return m_showGridLines; }
@@ -121,12 +124,12 @@ namespace AdaptiveCards
 
         std::shared_ptr<Table> table = BaseCardElement::Deserialize<Table>(context, json);
         table->SetShowGridLines(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::ShowGridLines, true, false));
-        table->SetGridStyle(ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleFromString));
+        table->SetGridStyle(ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleTryFromString));
         table->SetFirstRowAsHeaders(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::FirstRowAsHeaders, false, false));
         table->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-            json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+            json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
         table->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-            json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+            json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
         // manually deserialize columns
         if (const auto& columnsArray = ParseUtil::GetArray(json, AdaptiveCardSchemaKey::Columns, false); !columnsArray.empty())
@@ -87,9 +87,9 @@ namespace AdaptiveCards
         auto tableColumnDefinition = std::make_shared<TableColumnDefinition>();
 
         tableColumnDefinition->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-            json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+            json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
         tableColumnDefinition->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-            json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+            json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
         if (const auto& widthValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Width, false); !widthValue.empty())
         {
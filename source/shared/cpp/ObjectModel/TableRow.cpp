@@ -18,11 +18,14 @@ namespace AdaptiveCards
 
     void TableRow::PopulateKnownPropertiesSet()
     {
-        m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+        static const std::unordered_set<std::string> knownProperties =
+            ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                             {AdaptiveCardSchemaKey::Cells,
+                                              AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+                                              AdaptiveCardSchemaKey::Rtl,
+                                              AdaptiveCardSchemaKey::Style,
+                                              AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+        SetKnownProperties(knownProperties);
     }
 
     std::vector<std::shared_ptr<TableCell>>& TableRow::GetCells() { return m_cells; }
@@ -82,10 +85,10 @@ namespace AdaptiveCards
         std::shared_ptr<TableRow> tableRow = BaseCardElement::Deserialize<TableRow>(context, json);
 
         tableRow->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-            json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+            json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
         tableRow->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-            json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
-        tableRow->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+            json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
+        tableRow->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
         auto cells = ParseUtil::GetElementCollection<TableCell>(
             false, context, json, AdaptiveCardSchemaKey::Cells, false, CardElementTypeToString(CardElementType::TableCell));
         tableRow->SetCells(cells);
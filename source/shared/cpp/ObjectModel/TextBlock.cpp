@@ -62,7 +62,7 @@ void TextBlock::SetText(const std::string& value)
     m_textElementProperties->SetText(value);
 }
 
-DateTimePreparser TextBlock::GetTextForDateParsing() const
+const DateTimePreparser& TextBlock::GetTextForDateParsing() const
 {
     return m_textElementProperties->GetTextForDateParsing();
 }
@@ -175,10 +175,10 @@ std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& cont
     textBlock->m_textElementProperties->Deserialize(context, json);
 
     textBlock->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false));
-    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleFromString));
+    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleTryFromString));
     textBlock->SetMaxLines(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLines, 0));
     textBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     return textBlock;
 }
@@ -190,10 +190,14 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
-
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        auto properties = ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                                           {AdaptiveCardSchemaKey::Wrap,
+                                                            AdaptiveCardSchemaKey::Style,
+                                                            AdaptiveCardSchemaKey::MaxLines,
+                                                            AdaptiveCardSchemaKey::HorizontalAlignment});
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+        return properties;
+    }();
+    SetKnownProperties(knownProperties);
 }
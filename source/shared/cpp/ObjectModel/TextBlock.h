@@ -28,7 +28,8 @@ namespace AdaptiveCards
 
         std::string GetText() const;
         void SetText(const std::string& value);
-        DateTimePreparser GetTextForDateParsing() const;
+        // the reference stays valid until the next SetText or SetLanguage
+        const DateTimePreparser& GetTextForDateParsing() const;
 
         std::optional<TextStyle> GetStyle() const;
         void SetStyle(const std::optional<TextStyle> value);
@@ -2,7 +2,6 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include <iomanip>
-#include <regex>
 #include <iostream>
 #include <codecvt>
 #include "ParseContext.h"
@@ -60,49 +59,93 @@ std::string TextElementProperties::GetText() const
     return m_text;
 }
 
-// Convert some HTML entities into characters
-std::string TextElementProperties::_ProcessHTMLEntities(const std::string& input)
+namespace
 {
-    static const std::regex htmlEntities("&(amp|quot|lt|gt|nbsp);");
+    struct HtmlEntity
+    {
+        std::string_view name; // between the '&' and the ';'
+        char character;
+    };
 
-    if (std::regex_search(input, htmlEntities))
+    // clang-format off
+    constexpr HtmlEntity c_htmlEntities[] =
+        {
+            { "amp", '&' },
+            { "quot", '"' },
+            { "lt", '<' },
+            { "gt", '>' },
+            { "nbsp", ' ' }
+        };
+    // clang-format on
+
+    // The entity at input[position] (which holds a '&') and its length, or nullptr if there isn't a supported one
+    const HtmlEntity* MatchHtmlEntity(const std::string& input, size_t position, size_t& length)
     {
-        // this needs to be kept up to date with htmlEntities above
-        // clang-format off
-        static const std::vector<std::pair<std::regex, std::string>> replacements =
-            {
-                { std::regex("&quot;"), "\"" },
-                { std::regex("&lt;"), "<" },
-                { std::regex("&gt;"), ">" },
-                { std::regex("&nbsp;"), " " },
-                { std::regex("&amp;"), "&" } // amp must be last
-            };
-        // clang-format on
-
-        // handle entities
-        std::string output = input;
-
-        for (const auto& replacement : replacements)
+        const std::string_view rest = std::string_view(input).substr(position + 1);
+        for (const auto& entity : c_htmlEntities)
         {
-            output = std::regex_replace(output, replacement.first, replacement.second);
+            if (rest.size() > entity.name.size() && rest.compare(0, entity.name.size(), entity.name) == 0 &&
+                rest[entity.name.size()] == ';')
+            {
+                length = entity.name.size() + 2;
+                return &entity;
+            }
         }
+        return nullptr;
+    }
+}
 
-        return output;
+// Convert some HTML entities into characters. This is a single pass, so a decoded '&' never starts another entity
+// ("&amp;lt;" becomes "&lt;").
+void TextElementProperties::_ProcessHTMLEntities(const std::string& input, std::string& output)
+{
+    size_t position = input.find('&');
+    if (position == std::string::npos)
+    {
+        output = input;
+        return;
     }
-    else
+
+    output.clear();
+    output.reserve(input.size());
+    size_t copied = 0;
+    while (position != std::string::npos)
     {
-        return input;
+        size_t length;
+        if (const auto entity = MatchHtmlEntity(input, position, length))
+        {
+            output.append(input, copied, position - copied);
+            output.push_back(entity->character);
+            copied = position + length;
+            position = input.find('&', copied);
+        }
+        else
+        {
+            position = input.find('&', position + 1);
+        }
     }
+    output.append(input, copied, std::string::npos);
 }
 
 void TextElementProperties::SetText(const std::string& value)
 {
-    m_text = _ProcessHTMLEntities(value);
+    _ProcessHTMLEntities(value, m_text);
+    std::atomic_store(&m_dateTimePreparser, {});
 }
 
-DateTimePreparser TextElementProperties::GetTextForDateParsing() const
+const DateTimePreparser& TextElementProperties::GetTextForDateParsing() const
 {
-    return DateTimePreparser(m_text);
+    std::shared_ptr<const DateTimePreparser> dateTimePreparser = std::atomic_load(&m_dateTimePreparser);
+    if (!dateTimePreparser)
+    {
+        // if another thread got there first, use its result so that references handed out stay valid
+        auto parsed = std::make_shared<const DateTimePreparser>(m_text);
+        if (std::atomic_compare_exchange_strong(&m_dateTimePreparser, &dateTimePreparser, parsed))
+        {
+            dateTimePreparser = std::move(parsed);
+        }
+    }
+    return *dateTimePreparser;
 }
 
 std::optional<TextSize> TextElementProperties::GetTextSize() const
@@ -163,6 +206,7 @@ const std::string& TextElementProperties::GetLanguage() const
 void TextElementProperties::SetLanguage(const std::string& value)
 {
     m_language = value;
+    std::atomic_store(&m_dateTimePreparser, {});
 }
 
 void TextElementProperties::Deserialize(ParseContext& context, const Json::Value& json)
@@ -175,10 +219,10 @@ void TextElementProperties::Deserialize(ParseContext& context, const Json::Value
                                                        "required property, \"text\", is either empty or missing"));
     }
 
-    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeFromString));
-    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorFromString));
-    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightFromString));
-    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeFromString));
+    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeTryFromString));
+    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorTryFromString));
+    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightTryFromString));
+    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeTryFromString));
     SetIsSubtle(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::IsSubtle));
     SetLanguage(context.GetLanguage());
 }
@@ -25,7 +25,9 @@ namespace AdaptiveCards
 
         std::string GetText() const;
         void SetText(const std::string& value);
-        DateTimePreparser GetTextForDateParsing() const;
+        // Parsed on first use and kept until the text or language changes. The returned reference is invalidated by
+        // SetText and SetLanguage.
+        const DateTimePreparser& GetTextForDateParsing() const;
 
         std::optional<TextSize> GetTextSize() const;
         void SetTextSize(const std::optional<TextSize> value);
@@ -49,7 +51,7 @@ namespace AdaptiveCards
         virtual void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties);
 
     private:
-        static std::string _ProcessHTMLEntities(const std::string& input);
+        static void _ProcessHTMLEntities(const std::string& input, std::string& output);
 
         std::string m_text;
         std::optional<TextSize> m_textSize;
@@ -58,5 +60,8 @@ namespace AdaptiveCards
         std::optional<ForegroundColor> m_textColor;
         std::optional<bool> m_isSubtle;
         std::string m_language;
+        // Set at most once between changes to the text, by whichever thread gets there first; accessed through
+        // std::atomic_load/atomic_compare_exchange_strong since renderers may share an element across threads
+        mutable std::shared_ptr<const DateTimePreparser> m_dateTimePreparser;
     };
 }
@@ -136,7 +136,7 @@ std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& cont
     textInput->SetIsMultiline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiline, false));
     textInput->SetMaxLength(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLength, 0));
     textInput->SetTextInputStyle(
-        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleFromString));
+        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleTryFromString));
     textInput->SetInlineAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::InlineAction, false));
     textInput->SetRegex(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Regex));
 
@@ -150,9 +150,12 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Placeholder,
+                                          AdaptiveCardSchemaKey::Value,
+                                          AdaptiveCardSchemaKey::IsMultiline,
+                                          AdaptiveCardSchemaKey::MaxLength,
+                                          AdaptiveCardSchemaKey::TextInput});
+    SetKnownProperties(knownProperties);
 }
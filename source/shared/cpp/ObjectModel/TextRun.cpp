@@ -14,7 +14,12 @@ TextRun::TextRun() :
 
 void TextRun::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        auto properties = GetKnownProperties();
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+        return properties;
+    }();
+    SetKnownProperties(knownProperties);
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
@@ -46,7 +51,7 @@ void TextRun::SetText(const std::string& value)
     m_textElementProperties->SetText(value);
 }
 
-DateTimePreparser TextRun::GetTextForDateParsing() const
+const DateTimePreparser& TextRun::GetTextForDateParsing() const
 {
     return m_textElementProperties->GetTextForDateParsing();
 }
@@ -178,7 +183,10 @@ std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::
         inlineTextRun->SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
         inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-        HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+        if (context.GetCaptureAdditionalProperties())
+        {
+            HandleUnknownProperties(json, inlineTextRun->GetKnownProperties(), inlineTextRun->m_additionalProperties);
+        }
     }
 
     return inlineTextRun;
@@ -25,7 +25,8 @@ namespace AdaptiveCards
 
         std::string GetText() const;
         void SetText(const std::string& value);
-        DateTimePreparser GetTextForDateParsing() const;
+        // the reference stays valid until the next SetText or SetLanguage
+        const DateTimePreparser& GetTextForDateParsing() const;
 
         std::optional<TextSize> GetTextSize() const;
         void SetTextSize(const std::optional<TextSize> value);
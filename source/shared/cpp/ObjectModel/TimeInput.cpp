@@ -100,8 +100,11 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(ParseCon
 
 void TimeInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Max,
+                                          AdaptiveCardSchemaKey::Min,
+                                          AdaptiveCardSchemaKey::Placeholder,
+                                          AdaptiveCardSchemaKey::Value});
+    SetKnownProperties(knownProperties);
 }
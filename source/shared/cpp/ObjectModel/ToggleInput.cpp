@@ -113,9 +113,12 @@ std::shared_ptr<BaseCardElement> ToggleInputParser::DeserializeFromString(ParseC
 
 void ToggleInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::Title,
+                                          AdaptiveCardSchemaKey::Value,
+                                          AdaptiveCardSchemaKey::ValueOn,
+                                          AdaptiveCardSchemaKey::ValueOff,
+                                          AdaptiveCardSchemaKey::Wrap});
+    SetKnownProperties(knownProperties);
 }
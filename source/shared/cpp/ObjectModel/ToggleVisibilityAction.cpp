@@ -53,5 +53,8 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
 
 void ToggleVisibilityAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
+    static const std::unordered_set<std::string> knownProperties =
+        ParseUtil::ExtendKnownProperties(GetKnownProperties(),
+                                         {AdaptiveCardSchemaKey::TargetElements});
+    SetKnownProperties(knownProperties);
 }
@@ -42,18 +42,10 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(Pars
     {
         toggleVisibilityTargetElement->SetElementId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ElementId, true));
 
-        auto propertyValue = json.get(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible), Json::Value());
-        if (!propertyValue.empty())
+        const auto isVisible = ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::IsVisible);
+        if (isVisible.has_value())
         {
-            if (!propertyValue.isBool())
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                                 "Value for property " +
-                                                     AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible) +
-                                                     " was invalid. Expected type bool.");
-            }
-
-            toggleVisibilityTargetElement->SetIsVisible(propertyValue.asBool() ? IsVisibleTrue : IsVisibleFalse);
+            toggleVisibilityTargetElement->SetIsVisible(isVisible.value() ? IsVisibleTrue : IsVisibleFalse);
         }
     }
 
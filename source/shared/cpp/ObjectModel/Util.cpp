@@ -5,6 +5,7 @@
 #include "ColumnSet.h"
 #include "Container.h"
 #include "FactSet.h"
+#include "ParseUtil.h"
 #include "RichTextBlock.h"
 #include "ShowCardAction.h"
 #include "TextBlock.h"
@@ -19,77 +20,98 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
         return backgroundColor;
     }
 
-    const size_t backgroundColorLength = backgroundColor.length();
-    bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
-    for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
-    {
-        isValidColor = isxdigit(backgroundColor.at(i));
-    }
-
-    if (!isValidColor)
+    if (!ParseUtil::TryParseColor(backgroundColor).has_value())
     {
         warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidColorFormat,
                                                                          "Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format"));
         return "#00000000";
     }
 
-    std::string validBackgroundColor;
     // If format given was #RRGGBB
-    if (backgroundColorLength == 7)
+    if (backgroundColor.length() == 7)
     {
-        validBackgroundColor = "#FF" + backgroundColor.substr(1, 6);
-    }
-    else
-    {
-        validBackgroundColor = backgroundColor;
+        std::string validBackgroundColor;
+        validBackgroundColor.reserve(9);
+        validBackgroundColor.append("#FF").append(backgroundColor, 1, 6);
+        return validBackgroundColor;
     }
 
-    return validBackgroundColor;
+    return backgroundColor;
 }
 
-void ValidateUserInputForDimensionWithUnit(const std::string& unit,
-                                           const std::string& requestedDimension,
-                                           std::optional<int>& parsedDimension,
-                                           std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
+namespace
 {
-    constexpr auto warningMessage = "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
-    std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
-    stringPattern += ("(" + unit + ")$");
-    std::regex pattern(stringPattern);
-    std::smatch matches;
+    bool IsAsciiDigit(char ch) { return ch >= '0' && ch <= '9'; }
 
-    if (std::regex_search(requestedDimension, matches, pattern))
+    // Matches requestedDimension against ^[1-9]\d*(\.\d+)?<unit>$ and returns the length of its integral part, or 0
+    // if it doesn't match
+    size_t ScanDimensionWithUnit(const std::string& unit, const std::string& requestedDimension)
     {
-        try
+        const size_t length = requestedDimension.length();
+        if (length == 0 || requestedDimension[0] < '1' || requestedDimension[0] > '9')
         {
-            // stoi will get integral value upto non digit char indexed by idx
-            parsedDimension = std::stoi(matches[0]);
+            return 0;
         }
-        catch (const std::invalid_argument&)
+
+        size_t index = 1;
+        while (index < length && IsAsciiDigit(requestedDimension[index]))
         {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
-                                                                                  warningMessage + requestedDimension));
-            }
+            ++index;
         }
-        catch (const std::out_of_range&)
+        const size_t integralLength = index;
+
+        if (index < length && requestedDimension[index] == '.')
         {
-            if (warnings)
+            const size_t fractionStart = ++index;
+            while (index < length && IsAsciiDigit(requestedDimension[index]))
             {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
-                                                                                  "out of range: " + requestedDimension));
+                ++index;
+            }
+            if (index == fractionStart)
+            {
+                return 0;
             }
         }
+
+        return (requestedDimension.compare(index, std::string::npos, unit) == 0) ? integralLength : 0;
     }
-    else
+}
+
+void ValidateUserInputForDimensionWithUnit(const std::string& unit,
+                                           const std::string& requestedDimension,
+                                           std::optional<int>& parsedDimension,
+                                           std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
+{
+    constexpr auto warningMessage = "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
+
+    const size_t integralLength = ScanDimensionWithUnit(unit, requestedDimension);
+    if (integralLength == 0)
     {
         if (warnings)
         {
             warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
                                                                               warningMessage + requestedDimension));
         }
+        return;
+    }
+
+    // only the integral value is kept
+    int value = 0;
+    for (size_t i = 0; i < integralLength; ++i)
+    {
+        const int digit = requestedDimension[i] - '0';
+        if (value > (std::numeric_limits<int>::max() - digit) / 10)
+        {
+            if (warnings)
+            {
+                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
+                                                                                  "out of range: " + requestedDimension));
+            }
+            return;
+        }
+        value = value * 10 + digit;
     }
+    parsedDimension = value;
 }
 
 bool ShouldParseForExplicitDimension(const std::string& input)
@@ -148,9 +170,14 @@ void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties)
 {
+    // Read each member name in place and probe with one reused key string, so that the common case of a fully known
+    // element doesn't allocate
+    std::string key;
     for (auto it = json.begin(); it != json.end(); ++it)
     {
-        std::string key = it.key().asCString();
+        const char* end;
+        const char* begin = it.memberName(&end);
+        key.assign(begin, end);
         if (knownProperties.find(key) == knownProperties.end())
         {
             unknownProperties[key] = *it;
@@ -8,6 +8,11 @@
 std::string ValidateColor(const std::string& backgroundColor,
                           std::vector<std::shared_ptr<AdaptiveCards::AdaptiveCardParseWarning>>& warnings);
 
+void ValidateUserInputForDimensionWithUnit(const std::string& unit,
+                                           const std::string& requestedDimension,
+                                           std::optional<int>& parsedDimension,
+                                           std::vector<std::shared_ptr<AdaptiveCards::AdaptiveCardParseWarning>>* warnings);
+
 std::optional<int> ParseSizeForPixelSize(const std::string& sizeString,
                                          std::vector<std::shared_ptr<AdaptiveCards::AdaptiveCardParseWarning>>* warnings);
 
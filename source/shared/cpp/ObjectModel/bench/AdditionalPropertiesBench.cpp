@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // A card of `count` TextBlocks, each carrying `unknownCount` properties the object model doesn't know about
+    std::string MakeCard(unsigned int count, unsigned int unknownCount)
+    {
+        std::ostringstream card;
+        card << R"({"type":"AdaptiveCard","version":"1.5","body":[)";
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            card << (i ? "," : "") << R"({"type":"TextBlock","text":"Line )" << i << R"(","wrap":true,"size":"small")";
+            for (unsigned int j = 0; j < unknownCount; ++j)
+            {
+                card << R"(,"x-host-)" << j << R"(":{"value":)" << j << "}";
+            }
+            card << "}";
+        }
+        card << "]}";
+        return card.str();
+    }
+
+    void MeasureCard(AdaptiveCardsBench::BenchContext& context, const std::string& name, const std::string& card, bool capture)
+    {
+        const Json::Value json = ParseUtil::GetJsonValueFromString(card);
+        const std::string suffix = capture ? ".capture" : ".skip";
+
+        auto& deserialize = context.AddMeasurement("additional_properties", name + suffix + ".Deserialize");
+        std::shared_ptr<ParseResult> parseResult;
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            ParseContext parseContext;
+            parseContext.SetCaptureAdditionalProperties(capture);
+            deserialize.Run(card.size(), [&]() { parseResult = AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext); });
+        }
+
+        auto& serialize = context.AddMeasurement("additional_properties", name + suffix + ".Serialize");
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            serialize.Run(card.size(), [&]() { AdaptiveCardsBench::DoNotOptimize(parseResult->GetAdaptiveCard()->SerializeToJsonValue()); });
+        }
+    }
+
+    // With capture off, a card's serialized form must only lose the properties the object model doesn't know about
+    void Verify(const std::string& card, bool hasUnknownProperties)
+    {
+        const Json::Value json = ParseUtil::GetJsonValueFromString(card);
+        ParseContext captureContext;
+        ParseContext skipContext;
+        skipContext.SetCaptureAdditionalProperties(false);
+        const auto captured = AdaptiveCard::Deserialize(json, c_sharedModelVersion, captureContext)->GetAdaptiveCard()->Serialize();
+        const auto skipped = AdaptiveCard::Deserialize(json, c_sharedModelVersion, skipContext)->GetAdaptiveCard()->Serialize();
+        if ((captured == skipped) == hasUnknownProperties || (captured.find("x-host-") != std::string::npos) != hasUnknownProperties ||
+            skipped.find("x-host-") != std::string::npos)
+        {
+            throw std::runtime_error("additional_properties: unexpected round trip with capture turned off");
+        }
+    }
+
+    // Parse and serialize time with additional properties captured (the default) and skipped through
+    // ParseContext::SetCaptureAdditionalProperties, on cards without and with unknown properties.
+    void RunAdditionalPropertiesBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const unsigned int count = context.IsQuick() ? 100 : 1000;
+        const std::string knownOnly = MakeCard(count, 0);
+        const std::string withUnknown = MakeCard(count, 4);
+        Verify(knownOnly, false);
+        Verify(withUnknown, true);
+
+        for (const bool capture : {true, false})
+        {
+            MeasureCard(context, "known_only", knownOnly, capture);
+            MeasureCard(context, "with_unknown", withUnknown, capture);
+        }
+    }
+}
+
+REGISTER_BENCH_SUITE("additional_properties", RunAdditionalPropertiesBench);
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+
+#include <thread>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    std::string SerializeOrEmpty(const std::shared_ptr<ParseResult>& parseResult)
+    {
+        return parseResult ? parseResult->GetAdaptiveCard()->Serialize() : std::string{};
+    }
+
+    // Parsing the whole samples corpus one card at a time with DeserializeFromString against
+    // AdaptiveCard::DeserializeBatch on 1..N threads. Batch results must match the serial ones card for card.
+    void RunBatchParseBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        std::vector<std::string> jsonStrings;
+        std::size_t totalBytes = 0;
+        for (const auto& card : context.GetCorpus())
+        {
+            jsonStrings.push_back(card.json);
+            totalBytes += card.json.size();
+        }
+
+        auto elementRegistration = std::make_shared<ElementParserRegistration>();
+        auto actionRegistration = std::make_shared<ActionParserRegistration>();
+
+        std::vector<std::shared_ptr<ParseResult>> serialResults(jsonStrings.size());
+        auto& serial = context.AddMeasurement("batch_parse", "corpus.serial");
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            serial.Run(totalBytes, [&]() {
+                for (std::size_t j = 0; j < jsonStrings.size(); ++j)
+                {
+                    try
+                    {
+                        ParseContext parseContext(elementRegistration, actionRegistration);
+                        serialResults[j] = AdaptiveCard::DeserializeFromString(jsonStrings[j], c_sharedModelVersion, parseContext);
+                    }
+                    catch (const std::exception&)
+                    {
+                        serialResults[j] = nullptr;
+                    }
+                }
+            });
+        }
+
+        std::vector<std::string> expected;
+        std::transform(serialResults.begin(), serialResults.end(), std::back_inserter(expected), SerializeOrEmpty);
+
+        const unsigned int maxThreads = context.IsQuick() ? 2 : std::max(4U, std::thread::hardware_concurrency());
+        for (unsigned int threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+        {
+            auto& batch = context.AddMeasurement("batch_parse", "corpus.threads_" + std::to_string(threadCount));
+            std::vector<std::shared_ptr<ParseResult>> results;
+            std::vector<std::exception_ptr> errors;
+            for (unsigned int i = 0; i < context.GetIterations(); ++i)
+            {
+                batch.Run(totalBytes, [&]() {
+                    results = AdaptiveCard::DeserializeBatch(
+                        jsonStrings, c_sharedModelVersion, elementRegistration, actionRegistration, &errors, threadCount);
+                });
+            }
+
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                if (SerializeOrEmpty(results[i]) != expected[i] || (results[i] == nullptr) != (errors[i] != nullptr))
+                {
+                    throw std::runtime_error("batch_parse: result " + std::to_string(i) + " differs from a serial parse on " +
+                                             std::to_string(threadCount) + " threads");
+                }
+            }
+        }
+        context.AddMetric("batch_parse", "cards", static_cast<Json::UInt64>(jsonStrings.size()));
+        context.AddMetric("batch_parse", "hardware_concurrency", std::thread::hardware_concurrency());
+    }
+}
+
+REGISTER_BENCH_SUITE("batch_parse", RunBatchParseBench);
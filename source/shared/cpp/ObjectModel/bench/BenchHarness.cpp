@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <new>
+
+std::atomic<std::uint64_t> AdaptiveCardsBench::AllocationCounters::allocations{0};
+std::atomic<std::uint64_t> AdaptiveCardsBench::AllocationCounters::bytes{0};
+
+// Replace the global allocation functions so every benchmark can report allocations per operation. Only the counting
+// is added; memory still comes from malloc.
+void* operator new(std::size_t size)
+{
+    AdaptiveCardsBench::AllocationCounters::allocations.fetch_add(1, std::memory_order_relaxed);
+    AdaptiveCardsBench::AllocationCounters::bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace AdaptiveCardsBench
+{
+    Measurement::Measurement(std::string name) :
+        m_name(std::move(name)), m_allocations(0), m_allocatedBytes(0), m_bytesProcessed(0), m_failures(0)
+    {
+    }
+
+    void Measurement::Record(double nanoseconds, std::uint64_t allocations, std::uint64_t allocatedBytes, std::size_t bytesProcessed)
+    {
+        m_nanoseconds.push_back(nanoseconds);
+        m_allocations += allocations;
+        m_allocatedBytes += allocatedBytes;
+        m_bytesProcessed += bytesProcessed;
+    }
+
+    double Measurement::GetPercentile(double percentile) const
+    {
+        if (m_nanoseconds.empty())
+        {
+            return 0.0;
+        }
+
+        std::vector<double> sorted{m_nanoseconds};
+        const auto rank = static_cast<std::size_t>(percentile / 100.0 * (sorted.size() - 1) + 0.5);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+
+    double Measurement::GetMean() const
+    {
+        return m_nanoseconds.empty() ? 0.0 : GetTotalSeconds() * 1e9 / m_nanoseconds.size();
+    }
+
+    double Measurement::GetTotalSeconds() const
+    {
+        return std::accumulate(m_nanoseconds.begin(), m_nanoseconds.end(), 0.0) / 1e9;
+    }
+
+    Json::Value Measurement::ToJson() const
+    {
+        const double samples = static_cast<double>(m_nanoseconds.size());
+        const double totalSeconds = GetTotalSeconds();
+
+        Json::Value result;
+        result["name"] = m_name;
+        result["samples"] = static_cast<Json::UInt64>(m_nanoseconds.size());
+        result["failures"] = static_cast<Json::UInt64>(m_failures);
+        result["p50_us"] = GetPercentile(50.0) / 1e3;
+        result["p99_us"] = GetPercentile(99.0) / 1e3;
+        result["mean_us"] = GetMean() / 1e3;
+        result["allocations_per_op"] = samples ? m_allocations / samples : 0.0;
+        result["allocated_bytes_per_op"] = samples ? m_allocatedBytes / samples : 0.0;
+        result["ops_per_second"] = totalSeconds > 0.0 ? samples / totalSeconds : 0.0;
+        if (m_bytesProcessed)
+        {
+            result["mb_per_second"] = totalSeconds > 0.0 ? m_bytesProcessed / totalSeconds / (1024.0 * 1024.0) : 0.0;
+        }
+        return result;
+    }
+
+    BenchContext::BenchContext(std::vector<CorpusEntry> corpus, std::string samplesRoot, unsigned int iterations, bool quick) :
+        m_corpus(std::move(corpus)), m_samplesRoot(std::move(samplesRoot)), m_iterations(iterations), m_quick(quick),
+        m_metrics(Json::objectValue)
+    {
+    }
+
+    std::vector<CorpusEntry> BenchContext::GetCorpusSubset(const std::string& pathFragment) const
+    {
+        std::vector<CorpusEntry> subset;
+        std::copy_if(m_corpus.begin(), m_corpus.end(), std::back_inserter(subset), [&pathFragment](const CorpusEntry& entry) {
+            return entry.path.find(pathFragment) != std::string::npos;
+        });
+        return subset;
+    }
+
+    Measurement& BenchContext::AddMeasurement(const std::string& suite, const std::string& name)
+    {
+        m_measurements.emplace_back(suite, Measurement{name});
+        return m_measurements.back().second;
+    }
+
+    void BenchContext::AddMetric(const std::string& suite, const std::string& name, const Json::Value& value)
+    {
+        m_metrics[suite][name] = value;
+    }
+
+    Json::Value BenchContext::ToJson() const
+    {
+        std::uint64_t corpusBytes = 0;
+        for (const auto& entry : m_corpus)
+        {
+            corpusBytes += entry.json.size();
+        }
+
+        Json::Value root;
+        root["corpus"]["cards"] = static_cast<Json::UInt64>(m_corpus.size());
+        root["corpus"]["bytes"] = static_cast<Json::UInt64>(corpusBytes);
+        root["iterations"] = m_iterations;
+        root["quick"] = m_quick;
+
+        Json::Value& suites = root["suites"];
+        suites = Json::Value(Json::objectValue);
+        for (const auto& measurement : m_measurements)
+        {
+            suites[measurement.first]["measurements"].append(measurement.second.ToJson());
+        }
+        for (const auto& suiteName : m_metrics.getMemberNames())
+        {
+            suites[suiteName]["metrics"] = m_metrics[suiteName];
+        }
+        return root;
+    }
+
+    void BenchContext::PrintSummary(std::ostream& out) const
+    {
+        out << std::left << std::setw(52) << "measurement" << std::right << std::setw(10) << "samples" << std::setw(12)
+            << "p50 us" << std::setw(12) << "p99 us" << std::setw(12) << "allocs/op" << std::setw(12) << "ops/s"
+            << "\n";
+
+        for (const auto& measurement : m_measurements)
+        {
+            const auto json = measurement.second.ToJson();
+            out << std::left << std::setw(52) << (measurement.first + "/" + measurement.second.GetName()) << std::right
+                << std::setw(10) << json["samples"].asUInt64() << std::fixed << std::setprecision(2) << std::setw(12)
+                << json["p50_us"].asDouble() << std::setw(12) << json["p99_us"].asDouble() << std::setw(12)
+                << json["allocations_per_op"].asDouble() << std::setprecision(0) << std::setw(12)
+                << json["ops_per_second"].asDouble() << "\n";
+        }
+
+        for (const auto& suiteName : m_metrics.getMemberNames())
+        {
+            for (const auto& metricName : m_metrics[suiteName].getMemberNames())
+            {
+                out << suiteName << "/" << metricName << ": " << AdaptiveCards::ParseUtil::JsonToString(m_metrics[suiteName][metricName]);
+            }
+        }
+    }
+
+    std::vector<BenchSuite>& GetRegisteredSuites()
+    {
+        static std::vector<BenchSuite> suites;
+        return suites;
+    }
+
+    std::vector<CorpusEntry> LoadCorpus(const std::string& samplesRoot)
+    {
+        namespace fs = std::filesystem;
+
+        std::vector<CorpusEntry> corpus;
+        std::error_code error;
+        for (fs::recursive_directory_iterator it{samplesRoot, error}, end; !error && it != end; it.increment(error))
+        {
+            if (!it->is_regular_file() || it->path().extension() != ".json")
+            {
+                continue;
+            }
+
+            const auto relativePath = fs::relative(it->path(), samplesRoot).generic_string();
+            const bool isVersionedSample = relativePath.rfind("v1.", 0) == 0;
+            const bool isTemplateSample = relativePath.rfind("Templates/", 0) == 0;
+            if (!isVersionedSample && !isTemplateSample)
+            {
+                continue;
+            }
+
+            std::ifstream stream{it->path(), std::ios::binary};
+            std::ostringstream contents;
+            contents << stream.rdbuf();
+            corpus.push_back({relativePath, contents.str()});
+        }
+
+        // directory iteration order is unspecified; keep runs comparable across machines
+        std::sort(corpus.begin(), corpus.end(), [](const CorpusEntry& a, const CorpusEntry& b) { return a.path < b.path; });
+        return corpus;
+    }
+}
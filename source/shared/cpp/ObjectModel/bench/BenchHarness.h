@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+
+namespace AdaptiveCardsBench
+{
+    // Process-wide allocation counters, maintained by the operator new/delete replacements in BenchHarness.cpp.
+    struct AllocationCounters
+    {
+        static std::atomic<std::uint64_t> allocations;
+        static std::atomic<std::uint64_t> bytes;
+    };
+
+    struct AllocationSnapshot
+    {
+        std::uint64_t allocations;
+        std::uint64_t bytes;
+
+        static AllocationSnapshot Take()
+        {
+            return {AllocationCounters::allocations.load(std::memory_order_relaxed),
+                    AllocationCounters::bytes.load(std::memory_order_relaxed)};
+        }
+    };
+
+    // A single card of the benchmark corpus.
+    struct CorpusEntry
+    {
+        std::string path;
+        std::string json;
+    };
+
+    // Collects latency and allocation samples for one named operation and reduces them to a report entry.
+    class Measurement
+    {
+    public:
+        explicit Measurement(std::string name);
+
+        template<typename Fn> void Run(std::size_t bytesProcessed, Fn&& fn)
+        {
+            const auto allocationsBefore = AllocationSnapshot::Take();
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            const auto end = std::chrono::steady_clock::now();
+            const auto allocationsAfter = AllocationSnapshot::Take();
+
+            Record(std::chrono::duration<double, std::nano>(end - start).count(),
+                   allocationsAfter.allocations - allocationsBefore.allocations,
+                   allocationsAfter.bytes - allocationsBefore.bytes,
+                   bytesProcessed);
+        }
+
+        void Record(double nanoseconds, std::uint64_t allocations, std::uint64_t allocatedBytes, std::size_t bytesProcessed);
+        void RecordFailure() { ++m_failures; }
+
+        const std::string& GetName() const { return m_name; }
+        std::size_t GetSampleCount() const { return m_nanoseconds.size(); }
+        double GetPercentile(double percentile) const;
+        double GetMean() const;
+        double GetTotalSeconds() const;
+
+        Json::Value ToJson() const;
+
+    private:
+        std::string m_name;
+        std::vector<double> m_nanoseconds;
+        std::uint64_t m_allocations;
+        std::uint64_t m_allocatedBytes;
+        std::uint64_t m_bytesProcessed;
+        std::uint64_t m_failures;
+    };
+
+    class BenchContext
+    {
+    public:
+        BenchContext(std::vector<CorpusEntry> corpus, std::string samplesRoot, unsigned int iterations, bool quick);
+
+        // All cards under samples/v1.* and samples/Templates
+        const std::vector<CorpusEntry>& GetCorpus() const { return m_corpus; }
+        // Cards whose path contains the given fragment (e.g. "v1.5/Scenarios")
+        std::vector<CorpusEntry> GetCorpusSubset(const std::string& pathFragment) const;
+        const std::string& GetSamplesRoot() const { return m_samplesRoot; }
+
+        // Number of times each operation is repeated per input. Quick mode (used by ctest) runs everything once with
+        // reduced synthetic input sizes, to keep the benchmarks compiling and running without dominating test time.
+        unsigned int GetIterations() const { return m_iterations; }
+        bool IsQuick() const { return m_quick; }
+
+        Measurement& AddMeasurement(const std::string& suite, const std::string& name);
+        void AddMetric(const std::string& suite, const std::string& name, const Json::Value& value);
+
+        Json::Value ToJson() const;
+        void PrintSummary(std::ostream& out) const;
+
+    private:
+        std::vector<CorpusEntry> m_corpus;
+        std::string m_samplesRoot;
+        unsigned int m_iterations;
+        bool m_quick;
+        std::deque<std::pair<std::string, Measurement>> m_measurements;
+        Json::Value m_metrics;
+    };
+
+    struct BenchSuite
+    {
+        const char* name;
+        void (*run)(BenchContext& context);
+    };
+
+    std::vector<BenchSuite>& GetRegisteredSuites();
+
+    struct BenchSuiteRegistration
+    {
+        BenchSuiteRegistration(const char* name, void (*run)(BenchContext& context))
+        {
+            GetRegisteredSuites().push_back({name, run});
+        }
+    };
+
+    std::vector<CorpusEntry> LoadCorpus(const std::string& samplesRoot);
+
+    // Keeps the optimizer from discarding results of benchmarked expressions.
+    template<typename T> void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+}
+
+#define REGISTER_BENCH_SUITE(NAME, FN) \
+    static const AdaptiveCardsBench::BenchSuiteRegistration s_##FN##Registration{NAME, FN}
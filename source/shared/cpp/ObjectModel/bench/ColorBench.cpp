@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "Image.h"
+#include "ParseUtil.h"
+#include "Util.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // What ValidateColor used to do, kept here as the "before" reference
+    std::string SubstrValidateColor(const std::string& backgroundColor, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+    {
+        if (backgroundColor.empty())
+        {
+            return backgroundColor;
+        }
+
+        const size_t backgroundColorLength = backgroundColor.length();
+        bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
+        for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
+        {
+            isValidColor = isxdigit(backgroundColor.at(i));
+        }
+
+        if (!isValidColor)
+        {
+            warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidColorFormat,
+                                                                             "Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format"));
+            return "#00000000";
+        }
+
+        return backgroundColorLength == 7 ? "#FF" + backgroundColor.substr(1, 6) : backgroundColor;
+    }
+
+    // A mix of #RRGGBB and #AARRGGBB colors, as image background colors show up in cards
+    std::vector<std::string> MakeColors(unsigned int count)
+    {
+        std::vector<std::string> colors;
+        char color[16];
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            const unsigned int value = i * 2654435761U;
+            snprintf(color, sizeof(color), (i % 2) ? "#%06X" : "#%08X", (i % 2) ? (value & 0xFFFFFF) : value);
+            colors.emplace_back(color);
+        }
+        return colors;
+    }
+
+    void VerifyValidateColor(const std::vector<std::string>& colors)
+    {
+        for (const auto& color : colors)
+        {
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> expectedWarnings;
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> actualWarnings;
+            if (SubstrValidateColor(color, expectedWarnings) != ValidateColor(color, actualWarnings) ||
+                expectedWarnings.size() != actualWarnings.size())
+            {
+                throw std::runtime_error("colors: ValidateColor result for \"" + color + "\" differs from the reference");
+            }
+        }
+    }
+
+    template<typename Validate>
+    void MeasureValidation(AdaptiveCardsBench::BenchContext& context, const std::string& name, const std::vector<std::string>& colors, Validate validate)
+    {
+        auto& measurement = context.AddMeasurement("colors", name);
+        for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+        {
+            measurement.Run(colors.size() * 8, [&]() {
+                std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+                for (const auto& color : colors)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(validate(color, warnings));
+                }
+            });
+        }
+    }
+
+    // ValidateColor against the substr based implementation it replaced, and what a renderer pays to get an image
+    // background color as a number: re-parsing the string getter's result vs. reading the pre-parsed value.
+    void RunColorBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto colors = MakeColors(context.IsQuick() ? 200 : 2000);
+
+        std::vector<std::string> edgeCases{"", "#", "#FFF", "#12345", "#1234567", "#123456789", "#GGGGGG", "#abcdef",
+                                           "#ABCDEF12", "123456", "#12 456", "#12345g", "##123456"};
+        edgeCases.insert(edgeCases.end(), colors.begin(), colors.end());
+        VerifyValidateColor(edgeCases);
+
+        MeasureValidation(context, "validate.substr", colors, SubstrValidateColor);
+        MeasureValidation(context, "validate.append", colors, ValidateColor);
+
+        std::vector<std::shared_ptr<Image>> images;
+        for (const auto& color : colors)
+        {
+            images.push_back(std::make_shared<Image>());
+            images.back()->SetBackgroundColor(color);
+            if (images.back()->GetBackgroundColorArgb() != ParseUtil::TryParseColor(color))
+            {
+                throw std::runtime_error("colors: GetBackgroundColorArgb for \"" + color + "\" doesn't match the string");
+            }
+        }
+
+        auto& reparse = context.AddMeasurement("colors", "image_background.reparse");
+        auto& preparsed = context.AddMeasurement("colors", "image_background.argb");
+        for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+        {
+            reparse.Run(images.size() * 8, [&]() {
+                for (const auto& image : images)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(ParseUtil::TryParseColor(image->GetBackgroundColor()));
+                }
+            });
+            preparsed.Run(images.size() * 8, [&]() {
+                for (const auto& image : images)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(image->GetBackgroundColorArgb());
+                }
+            });
+        }
+        context.AddMetric("colors", "colors", static_cast<Json::UInt64>(colors.size()));
+    }
+}
+
+REGISTER_BENCH_SUITE("colors", RunColorBench);
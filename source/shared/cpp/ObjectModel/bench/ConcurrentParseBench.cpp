@@ -0,0 +1,208 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "ActionSet.h"
+#include "BenchHarness.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "Table.h"
+#include "TableRow.h"
+
+#include <thread>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    void CollectInternalIds(const AdaptiveCard& card, std::vector<InternalId>& ids);
+
+    void CollectInternalIds(const std::shared_ptr<BaseActionElement>& action, std::vector<InternalId>& ids)
+    {
+        if (action == nullptr)
+        {
+            return;
+        }
+
+        ids.push_back(action->GetInternalId());
+        if (const auto showCard = std::dynamic_pointer_cast<ShowCardAction>(action))
+        {
+            if (showCard->GetCard() != nullptr)
+            {
+                CollectInternalIds(*showCard->GetCard(), ids);
+            }
+        }
+    }
+
+    template<typename T>
+    void CollectInternalIds(const std::vector<std::shared_ptr<T>>& elements, std::vector<InternalId>& ids)
+    {
+        for (const auto& element : elements)
+        {
+            ids.push_back(element->GetInternalId());
+            if (const auto collection = std::dynamic_pointer_cast<CollectionTypeElement>(element))
+            {
+                CollectInternalIds(collection->GetSelectAction(), ids);
+            }
+
+            if (const auto container = std::dynamic_pointer_cast<Container>(element))
+            {
+                CollectInternalIds(container->GetItems(), ids);
+            }
+            else if (const auto column = std::dynamic_pointer_cast<Column>(element))
+            {
+                CollectInternalIds(column->GetItems(), ids);
+            }
+            else if (const auto columnSet = std::dynamic_pointer_cast<ColumnSet>(element))
+            {
+                CollectInternalIds(columnSet->GetColumns(), ids);
+            }
+            else if (const auto table = std::dynamic_pointer_cast<Table>(element))
+            {
+                CollectInternalIds(table->GetRows(), ids);
+            }
+            else if (const auto row = std::dynamic_pointer_cast<TableRow>(element))
+            {
+                CollectInternalIds(row->GetCells(), ids);
+            }
+            else if (const auto imageSet = std::dynamic_pointer_cast<ImageSet>(element))
+            {
+                CollectInternalIds(imageSet->GetImages(), ids);
+            }
+            else if (const auto image = std::dynamic_pointer_cast<Image>(element))
+            {
+                CollectInternalIds(image->GetSelectAction(), ids);
+            }
+            else if (const auto actionSet = std::dynamic_pointer_cast<ActionSet>(element))
+            {
+                for (const auto& action : actionSet->GetActions())
+                {
+                    CollectInternalIds(action, ids);
+                }
+            }
+        }
+    }
+
+    // Internal ids of the card and of every element and action in it, nested ones and show cards included, with one
+    // entry per element so that an id handed out twice within the card is counted too
+    void CollectInternalIds(const AdaptiveCard& card, std::vector<InternalId>& ids)
+    {
+        ids.push_back(card.GetInternalId());
+        CollectInternalIds(card.GetBody(), ids);
+        for (const auto& action : card.GetActions())
+        {
+            CollectInternalIds(action, ids);
+        }
+        CollectInternalIds(card.GetSelectAction(), ids);
+    }
+
+    std::vector<Json::Value> GetParseableCards(const std::vector<AdaptiveCardsBench::CorpusEntry>& corpus)
+    {
+        std::vector<Json::Value> cards;
+        for (const auto& card : corpus)
+        {
+            try
+            {
+                auto json = ParseUtil::GetJsonValueFromString(card.json);
+                ParseContext parseContext;
+                const auto parsedCard = AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext)->GetAdaptiveCard();
+
+                // a card for a version the object model doesn't support comes back as a fallback text card, whose text
+                // block is made along with the card and shares its id by design; nothing is parsed for those
+                const auto& body = parsedCard->GetBody();
+                if (body.size() != 1 || body.front()->GetInternalId() != parsedCard->GetInternalId())
+                {
+                    cards.push_back(std::move(json));
+                }
+            }
+            catch (const std::exception&)
+            {
+                // cards the object model rejects aren't interesting here
+            }
+        }
+        return cards;
+    }
+
+    // Parses the corpus on `threadCount` threads at once and returns the wall-clock seconds it took. Every internal id
+    // handed out along the way is appended to `ids`.
+    double ParseOnThreads(const std::vector<Json::Value>& cards,
+                          unsigned int threadCount,
+                          unsigned int passes,
+                          std::vector<InternalId>& ids)
+    {
+        std::vector<std::vector<InternalId>> threadIds(threadCount);
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&cards, passes, &threadId = threadIds[t]]() {
+                for (unsigned int pass = 0; pass < passes; ++pass)
+                {
+                    for (const auto& card : cards)
+                    {
+                        ParseContext parseContext;
+                        const auto parseResult = AdaptiveCard::Deserialize(card, c_sharedModelVersion, parseContext);
+                        CollectInternalIds(*parseResult->GetAdaptiveCard(), threadId);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        for (const auto& threadId : threadIds)
+        {
+            ids.insert(ids.end(), threadId.begin(), threadId.end());
+        }
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    // Stress test for InternalId allocation under concurrency: every thread parses the whole corpus, all ids handed
+    // out across all threads must be distinct, and throughput should scale with the thread count up to the number of
+    // cores. A collision aborts the run (and fails the ctest smoke run).
+    void RunConcurrentParseBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto cards = GetParseableCards(context.GetCorpus());
+        const unsigned int passes = context.IsQuick() ? 1 : std::max(1U, context.GetIterations() / 4);
+        const unsigned int maxThreads = context.IsQuick() ? 2 : std::max(4U, std::thread::hardware_concurrency());
+
+        double singleThreadCardsPerSecond = 0;
+        for (unsigned int threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+        {
+            std::vector<InternalId> ids;
+            const double seconds = ParseOnThreads(cards, threadCount, passes, ids);
+
+            const std::unordered_set<InternalId, InternalIdKeyHash> uniqueIds(ids.begin(), ids.end());
+            if (uniqueIds.size() != ids.size())
+            {
+                throw std::runtime_error("concurrent_parse: " + std::to_string(ids.size() - uniqueIds.size()) +
+                                         " internal ids handed out more than once on " + std::to_string(threadCount) + " threads");
+            }
+
+            const double cardsPerSecond = static_cast<double>(cards.size()) * passes * threadCount / seconds;
+            if (threadCount == 1)
+            {
+                singleThreadCardsPerSecond = cardsPerSecond;
+            }
+
+            Json::Value result;
+            result["cards"] = static_cast<Json::UInt64>(cards.size() * passes * threadCount);
+            result["ids_checked"] = static_cast<Json::UInt64>(ids.size());
+            result["cards_per_second"] = cardsPerSecond;
+            result["speedup"] = cardsPerSecond / singleThreadCardsPerSecond;
+            context.AddMetric("concurrent_parse", "threads_" + std::to_string(threadCount), result);
+        }
+        context.AddMetric("concurrent_parse", "hardware_concurrency", std::thread::hardware_concurrency());
+    }
+}
+
+REGISTER_BENCH_SUITE("concurrent_parse", RunConcurrentParseBench);
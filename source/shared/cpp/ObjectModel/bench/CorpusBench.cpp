@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // Parse, serialize and resource enumeration over every card of the samples corpus. Cards that fail to parse (some
+    // samples intentionally exercise error paths) are counted as failures and excluded from the other measurements.
+    void RunCorpusBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        auto& parse = context.AddMeasurement("corpus", "DeserializeFromString");
+        auto& serialize = context.AddMeasurement("corpus", "Serialize");
+        auto& resources = context.AddMeasurement("corpus", "GetResourceInformation");
+
+        for (const auto& entry : context.GetCorpus())
+        {
+            for (unsigned int i = 0; i < context.GetIterations(); ++i)
+            {
+                std::shared_ptr<ParseResult> parseResult;
+                try
+                {
+                    parse.Run(entry.json.size(), [&]() {
+                        parseResult = AdaptiveCard::DeserializeFromString(entry.json, c_sharedModelVersion);
+                    });
+                }
+                catch (const std::exception&)
+                {
+                    parse.RecordFailure();
+                    break;
+                }
+
+                const auto card = parseResult->GetAdaptiveCard();
+
+                std::string serialized;
+                serialize.Run(0, [&]() { serialized = card->Serialize(); });
+                AdaptiveCardsBench::DoNotOptimize(serialized);
+
+                std::vector<RemoteResourceInformation> resourceInformation;
+                resources.Run(0, [&]() { resourceInformation = card->GetResourceInformation(); });
+                AdaptiveCardsBench::DoNotOptimize(resourceInformation);
+            }
+        }
+    }
+}
+
+REGISTER_BENCH_SUITE("corpus", RunCorpusBench);
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "DateTimePreparser.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // A digest-style text block: `count` lines of prose, each carrying a {{DATE(...)}} or {{TIME(...)}} token in one
+    // of the supported styles and time zone forms. Every fifth line also has a "{{" that isn't a token.
+    std::string MakeDigestText(unsigned int count)
+    {
+        static const char* const tokens[] = {"{{DATE(2017-02-14T06:08:39Z)}}",
+                                             "{{DATE(2019-11-03T18:30:00+01:00, SHORT)}}",
+                                             "{{DATE(2020-02-29T09:15:00-08:00, LONG)}}",
+                                             "{{DATE(2021-07-04T12:00:00Z,COMPACT)}}",
+                                             "{{TIME(2017-02-14T06:08:39Z)}}",
+                                             "{{TIME(2022-12-31T23:59:00+05:30)}}"};
+
+        std::string text;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            text += "Build " + std::to_string(i) + " finished on " + tokens[i % std::size(tokens)];
+            text += (i % 5 == 4) ? " with {{unresolved}} notes.\n" : " without failures.\n";
+        }
+        return text;
+    }
+
+    // DateTimePreparser on long text blocks with a growing number of date/time tokens. Time per token should stay
+    // flat: the text after each token must not be copied or searched again from its start.
+    void RunDateTimePreparseBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const std::vector<unsigned int> counts =
+            context.IsQuick() ? std::vector<unsigned int>{10} : std::vector<unsigned int>{10, 50, 200, 1000};
+
+        for (const auto count : counts)
+        {
+            const std::string text = MakeDigestText(count);
+            const std::string name = "tokens_" + std::to_string(count);
+
+            auto& preparse = context.AddMeasurement("datetime_preparse", name);
+            for (unsigned int i = 0; i < context.GetIterations(); ++i)
+            {
+                preparse.Run(text.size(), [&]() { AdaptiveCardsBench::DoNotOptimize(DateTimePreparser(text)); });
+            }
+            context.AddMetric("datetime_preparse", name + ".p50_ns_per_token", preparse.GetPercentile(50) / count);
+        }
+
+        const std::string plain = "Nothing to replace {{here}} or {{DATE(soon)}}, " + std::string(2000, 'x');
+        auto& noTokens = context.AddMeasurement("datetime_preparse", "no_tokens");
+        for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+        {
+            noTokens.Run(plain.size(), [&]() { AdaptiveCardsBench::DoNotOptimize(DateTimePreparser(plain)); });
+        }
+    }
+}
+
+REGISTER_BENCH_SUITE("datetime_preparse", RunDateTimePreparseBench);
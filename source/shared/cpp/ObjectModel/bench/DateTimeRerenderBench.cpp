@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "TextBlock.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    std::vector<std::shared_ptr<TextBlock>> MakeTextBlocks(unsigned int count)
+    {
+        static const char* const tokens[] = {"{{DATE(2017-02-14T06:08:39Z)}}",
+                                             "{{DATE(2019-11-03T18:30:00+01:00, SHORT)}}",
+                                             "{{TIME(2022-12-31T23:59:00+05:30)}}"};
+        std::vector<std::shared_ptr<TextBlock>> textBlocks;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            textBlocks.push_back(std::make_shared<TextBlock>());
+            textBlocks.back()->SetText("Build " + std::to_string(i) + " finished on " + tokens[i % std::size(tokens)] +
+                                       " without failures.");
+        }
+        return textBlocks;
+    }
+
+    template<typename Render>
+    void MeasureRerenders(AdaptiveCardsBench::BenchContext& context,
+                          const std::string& name,
+                          const std::vector<std::shared_ptr<TextBlock>>& textBlocks,
+                          unsigned int renders,
+                          Render render)
+    {
+        auto& measurement = context.AddMeasurement("datetime_rerender", name);
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            measurement.Run(0, [&]() {
+                for (unsigned int j = 0; j < renders; ++j)
+                {
+                    for (const auto& textBlock : textBlocks)
+                    {
+                        render(*textBlock);
+                    }
+                }
+            });
+        }
+
+        const auto before = AdaptiveCardsBench::AllocationSnapshot::Take();
+        for (const auto& textBlock : textBlocks)
+        {
+            render(*textBlock);
+        }
+        const auto after = AdaptiveCardsBench::AllocationSnapshot::Take();
+
+        Json::Value amortized;
+        amortized["p50_ns_per_text_block_render"] = measurement.GetPercentile(50) / (renders * textBlocks.size());
+        amortized["allocations_per_text_block_render"] = static_cast<double>(after.allocations - before.allocations) / textBlocks.size();
+        context.AddMetric("datetime_rerender", name, amortized);
+    }
+
+    // What a renderer pays for a text block's date/time tokens when a card is rendered over and over: preparsing the
+    // text every time (as GetTextForDateParsing used to) against the preparser cached on the element, read through the
+    // shared_ptr copies of GetTextTokens and through GetTokens.
+    void RunDateTimeRerenderBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto textBlocks = MakeTextBlocks(50);
+        const unsigned int renders = context.IsQuick() ? 5 : 20;
+
+        for (const auto& textBlock : textBlocks)
+        {
+            const auto& cached = textBlock->GetTextForDateParsing().GetTokens();
+            const auto uncached = DateTimePreparser(textBlock->GetText()).GetTextTokens();
+            if (cached.size() != uncached.size() ||
+                !std::equal(cached.begin(), cached.end(), uncached.begin(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.GetText() == rhs->GetText() && lhs.GetFormat() == rhs->GetFormat() && lhs.GetDay() == rhs->GetDay();
+                }))
+            {
+                throw std::runtime_error("datetime_rerender: cached tokens differ from a fresh preparse");
+            }
+        }
+
+        std::size_t textSize = 0;
+        MeasureRerenders(context, "render.preparse_each_time", textBlocks, renders, [&](const TextBlock& textBlock) {
+            for (const auto& token : DateTimePreparser(textBlock.GetText()).GetTextTokens())
+            {
+                textSize += token->GetText().size();
+            }
+        });
+        MeasureRerenders(context, "render.cached.GetTextTokens", textBlocks, renders, [&](const TextBlock& textBlock) {
+            for (const auto& token : textBlock.GetTextForDateParsing().GetTextTokens())
+            {
+                textSize += token->GetText().size();
+            }
+        });
+        MeasureRerenders(context, "render.cached.GetTokens", textBlocks, renders, [&](const TextBlock& textBlock) {
+            for (const auto& token : textBlock.GetTextForDateParsing().GetTokens())
+            {
+                textSize += token.GetFormat() == DateTimePreparsedTokenFormat::RegularString ? token.GetText().size() : 1;
+            }
+        });
+        AdaptiveCardsBench::DoNotOptimize(textSize);
+    }
+}
+
+REGISTER_BENCH_SUITE("datetime_rerender", RunDateTimeRerenderBench);
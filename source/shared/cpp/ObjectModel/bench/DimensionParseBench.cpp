@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "Util.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // What ValidateUserInputForDimensionWithUnit used to do: build the pattern and a std::regex on every call. Kept
+    // here as the "before" reference.
+    void RegexValidateDimension(const std::string& unit,
+                                const std::string& requestedDimension,
+                                std::optional<int>& parsedDimension,
+                                std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
+    {
+        constexpr auto warningMessage = "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
+        std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
+        stringPattern += ("(" + unit + ")$");
+        std::regex pattern(stringPattern);
+        std::smatch matches;
+
+        if (std::regex_search(requestedDimension, matches, pattern))
+        {
+            try
+            {
+                parsedDimension = std::stoi(matches[0]);
+            }
+            catch (const std::out_of_range&)
+            {
+                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
+                                                                                  "out of range: " + requestedDimension));
+            }
+        }
+        else
+        {
+            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
+                                                                              warningMessage + requestedDimension));
+        }
+    }
+
+    // String values of every width, height and minHeight property in the corpus that ParseSizeForPixelSize would
+    // look at (the ones with a digit in them)
+    void CollectDimensions(const Json::Value& json, std::vector<std::string>& dimensions)
+    {
+        if (json.isObject())
+        {
+            for (auto it = json.begin(); it != json.end(); ++it)
+            {
+                const std::string key = it.name();
+                if ((key == "width" || key == "height" || key == "minHeight") && it->isString())
+                {
+                    const std::string value = it->asString();
+                    if (std::any_of(value.begin(), value.end(), [](unsigned char ch) { return std::isdigit(ch); }))
+                    {
+                        dimensions.push_back(value);
+                    }
+                }
+                CollectDimensions(*it, dimensions);
+            }
+        }
+        else if (json.isArray())
+        {
+            for (const auto& item : json)
+            {
+                CollectDimensions(item, dimensions);
+            }
+        }
+    }
+
+    std::vector<std::string> GetDimensions(const std::vector<AdaptiveCardsBench::CorpusEntry>& corpus)
+    {
+        std::vector<std::string> dimensions;
+        for (const auto& card : corpus)
+        {
+            try
+            {
+                CollectDimensions(ParseUtil::GetJsonValueFromString(card.json), dimensions);
+            }
+            catch (const std::exception&)
+            {
+                // not valid JSON
+            }
+        }
+        return dimensions;
+    }
+
+    template<typename Validate>
+    void MeasureValidation(AdaptiveCardsBench::BenchContext& context,
+                           const std::string& name,
+                           const std::vector<std::string>& dimensions,
+                           Validate validate)
+    {
+        std::size_t totalBytes = 0;
+        for (const auto& dimension : dimensions)
+        {
+            totalBytes += dimension.size();
+        }
+
+        auto& measurement = context.AddMeasurement("dimension_parse", name);
+        for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+        {
+            measurement.Run(totalBytes, [&]() {
+                std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+                for (const auto& dimension : dimensions)
+                {
+                    std::optional<int> parsed;
+                    validate("px", dimension, parsed, &warnings);
+                    AdaptiveCardsBench::DoNotOptimize(parsed);
+                }
+                AdaptiveCardsBench::DoNotOptimize(warnings);
+            });
+        }
+    }
+
+    // Both implementations must agree on the parsed value and on the warning raised, if any
+    void VerifyAgainstRegex(const std::vector<std::string>& dimensions)
+    {
+        for (const auto& dimension : dimensions)
+        {
+            std::optional<int> expected;
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> expectedWarnings;
+            RegexValidateDimension("px", dimension, expected, &expectedWarnings);
+
+            std::optional<int> actual;
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> actualWarnings;
+            ValidateUserInputForDimensionWithUnit("px", dimension, actual, &actualWarnings);
+
+            const bool sameWarnings =
+                expectedWarnings.size() == actualWarnings.size() &&
+                std::equal(expectedWarnings.begin(), expectedWarnings.end(), actualWarnings.begin(), [](const auto& lhs, const auto& rhs) {
+                    return lhs->GetStatusCode() == rhs->GetStatusCode() && lhs->GetReason() == rhs->GetReason();
+                });
+            if (expected != actual || !sameWarnings)
+            {
+                throw std::runtime_error("dimension_parse: result for \"" + dimension + "\" differs from the regex");
+            }
+        }
+    }
+
+    // ValidateUserInputForDimensionWithUnit against the std::regex implementation it replaced, on the pixel
+    // dimensions found in the samples corpus.
+    void RunDimensionParseBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto dimensions = GetDimensions(context.GetCorpus());
+
+        std::vector<std::string> edgeCases{"", "px", "0px", "01px", "1px", "1.px", ".5px", "1.5px", "1.5.5px", "1.5pxx",
+                                           "1pX", " 1px", "1 px", "-1px", "1e2px", "2147483647px", "2147483648px",
+                                           "2147483647.99px", "99999999999999999999px", "auto", "stretch", "10"};
+        edgeCases.insert(edgeCases.end(), dimensions.begin(), dimensions.end());
+        VerifyAgainstRegex(edgeCases);
+
+        MeasureValidation(context, "corpus.regex", dimensions, RegexValidateDimension);
+        MeasureValidation(context, "corpus.scanner", dimensions, ValidateUserInputForDimensionWithUnit);
+        context.AddMetric("dimension_parse", "dimensions", static_cast<Json::UInt64>(dimensions.size()));
+    }
+}
+
+REGISTER_BENCH_SUITE("dimension_parse", RunDimensionParseBench);
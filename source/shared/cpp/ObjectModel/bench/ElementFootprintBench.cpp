@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ActionSet.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "OpenUrlAction.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TextRun.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // Heap bytes and allocations needed to default-construct one T, plus its object size. allocated_bytes_per_op is
+    // the per-element memory cost that every parsed element pays before any of its properties are set.
+    template<typename T> void MeasureFootprint(AdaptiveCardsBench::BenchContext& context, const std::string& name)
+    {
+        constexpr unsigned int elementsPerSample = 100;
+        auto& construct = context.AddMeasurement("element_footprint", name + ".construct_x100");
+
+        const unsigned int samples = context.IsQuick() ? 1 : 20 * context.GetIterations();
+        for (unsigned int i = 0; i < samples; ++i)
+        {
+            std::vector<std::shared_ptr<T>> elements;
+            elements.reserve(elementsPerSample);
+            construct.Run(0, [&]() {
+                for (unsigned int j = 0; j < elementsPerSample; ++j)
+                {
+                    elements.push_back(std::make_shared<T>());
+                }
+            });
+            AdaptiveCardsBench::DoNotOptimize(elements);
+        }
+
+        const auto before = AdaptiveCardsBench::AllocationSnapshot::Take();
+        auto element = std::make_shared<T>();
+        const auto after = AdaptiveCardsBench::AllocationSnapshot::Take();
+        AdaptiveCardsBench::DoNotOptimize(element);
+
+        Json::Value footprint;
+        footprint["sizeof"] = static_cast<Json::UInt64>(sizeof(T));
+        footprint["heap_bytes"] = static_cast<Json::UInt64>(after.bytes - before.bytes);
+        footprint["heap_allocations"] = static_cast<Json::UInt64>(after.allocations - before.allocations);
+        context.AddMetric("element_footprint", name, footprint);
+    }
+
+    void RunElementFootprintBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        MeasureFootprint<TextBlock>(context, "TextBlock");
+        MeasureFootprint<RichTextBlock>(context, "RichTextBlock");
+        MeasureFootprint<TextRun>(context, "TextRun");
+        MeasureFootprint<Image>(context, "Image");
+        MeasureFootprint<Container>(context, "Container");
+        MeasureFootprint<ColumnSet>(context, "ColumnSet");
+        MeasureFootprint<Column>(context, "Column");
+        MeasureFootprint<FactSet>(context, "FactSet");
+        MeasureFootprint<ActionSet>(context, "ActionSet");
+        MeasureFootprint<TextInput>(context, "TextInput");
+        MeasureFootprint<ChoiceSetInput>(context, "ChoiceSetInput");
+        MeasureFootprint<SubmitAction>(context, "SubmitAction");
+        MeasureFootprint<OpenUrlAction>(context, "OpenUrlAction");
+        MeasureFootprint<AdaptiveCard>(context, "AdaptiveCard");
+    }
+}
+
+REGISTER_BENCH_SUITE("element_footprint", RunElementFootprintBench);
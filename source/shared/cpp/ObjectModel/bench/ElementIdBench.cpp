@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // A generated form of `count` uniquely id'd inputs. With `withFallback`, every input also carries fallback
+    // content that reuses the input's id, which is what makes ParseContext look at earlier entries for an id.
+    std::string MakeFormCard(unsigned int count, bool withFallback)
+    {
+        std::ostringstream card;
+        card << R"({"type":"AdaptiveCard","version":"1.5","body":[)";
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            card << (i ? "," : "") << R"({"type":"Input.Text","id":"input)" << i << R"(","label":"Field )" << i << '"';
+            if (withFallback)
+            {
+                card << R"(,"fallback":{"type":"Container","items":[{"type":"TextBlock","id":"input)" << i
+                     << R"(","text":"unsupported"}]})";
+            }
+            card << "}";
+        }
+        card << "]}";
+        return card.str();
+    }
+
+    void MeasureForms(AdaptiveCardsBench::BenchContext& context, const std::string& shape, bool withFallback)
+    {
+        const std::vector<unsigned int> counts =
+            context.IsQuick() ? std::vector<unsigned int>{100, 200} : std::vector<unsigned int>{1250, 2500, 5000, 10000};
+
+        for (const auto count : counts)
+        {
+            const std::string card = MakeFormCard(count, withFallback);
+            const Json::Value json = ParseUtil::GetJsonValueFromString(card);
+            const std::string name = shape + "_" + std::to_string(count);
+
+            auto& deserialize = context.AddMeasurement("element_ids", name + ".Deserialize");
+            for (unsigned int i = 0; i < context.GetIterations(); ++i)
+            {
+                ParseContext parseContext;
+                deserialize.Run(card.size(), [&]() {
+                    AdaptiveCardsBench::DoNotOptimize(AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext));
+                });
+            }
+            context.AddMetric("element_ids", name + ".p50_ns_per_element", deserialize.GetPercentile(50) / count);
+        }
+    }
+
+    // Id collision tracking cost on large generated forms: time per element should stay flat as the element count
+    // grows from 1250 to 10000.
+    void RunElementIdBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        MeasureForms(context, "unique", false);
+        MeasureForms(context, "fallback_reuse", true);
+    }
+}
+
+REGISTER_BENCH_SUITE("element_ids", RunElementIdBench);
@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "EnumMagic.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // The hash CaseInsensitiveHash used to be: a sum of the uppercased bytes. Kept here as the "before" reference.
+    struct AdditiveCaseInsensitiveHash
+    {
+        size_t operator()(const std::string& keyval) const noexcept
+        {
+            return std::accumulate(keyval.cbegin(), keyval.cend(), size_t{0}, [](size_t acc, unsigned char c) {
+                return acc + std::toupper(c);
+            });
+        }
+    };
+
+    std::vector<std::string> GetSchemaKeyStrings()
+    {
+        std::vector<std::string> keys;
+        for (int i = 0; i <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); ++i)
+        {
+            try
+            {
+                keys.push_back(AdaptiveCardSchemaKeyToString(static_cast<AdaptiveCardSchemaKey>(i)));
+            }
+            catch (const std::out_of_range&)
+            {
+                // not every key has a string form
+            }
+        }
+        return keys;
+    }
+
+    template<typename Hash>
+    void MeasureHash(AdaptiveCardsBench::BenchContext& context, const std::string& name, const std::vector<std::string>& keys)
+    {
+        std::unordered_map<std::string, int, Hash, CaseInsensitiveEqualTo> map;
+        for (const auto& key : keys)
+        {
+            map.emplace(key, 0);
+        }
+
+        size_t maxBucketSize = 0;
+        size_t occupiedBuckets = 0;
+        for (size_t bucket = 0; bucket < map.bucket_count(); ++bucket)
+        {
+            const auto size = map.bucket_size(bucket);
+            maxBucketSize = std::max(maxBucketSize, size);
+            occupiedBuckets += size ? 1 : 0;
+        }
+
+        std::unordered_set<size_t> distinctHashes;
+        for (const auto& key : keys)
+        {
+            distinctHashes.insert(Hash{}(key));
+        }
+
+        Json::Value distribution;
+        distribution["keys"] = static_cast<Json::UInt64>(map.size());
+        distribution["buckets"] = static_cast<Json::UInt64>(map.bucket_count());
+        distribution["occupied_buckets"] = static_cast<Json::UInt64>(occupiedBuckets);
+        distribution["max_bucket_size"] = static_cast<Json::UInt64>(maxBucketSize);
+        distribution["mean_chain_length"] = occupiedBuckets ? static_cast<double>(map.size()) / occupiedBuckets : 0.0;
+        distribution["distinct_hashes"] = static_cast<Json::UInt64>(distinctHashes.size());
+        context.AddMetric("enum_lookup", name + ".distribution", distribution);
+
+        // Look up every key in a case different from the one it was inserted with, as parsers do for type names
+        std::vector<std::string> probes;
+        for (const auto& key : keys)
+        {
+            std::string probe{key};
+            std::transform(probe.begin(), probe.end(), probe.begin(), [](unsigned char c) { return std::toupper(c); });
+            probes.push_back(std::move(probe));
+        }
+
+        constexpr unsigned int lookupsPerSample = 1000;
+        auto& lookups = context.AddMeasurement("enum_lookup", name + ".lookup_x1000");
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            for (const auto& probe : probes)
+            {
+                lookups.Run(0, [&]() {
+                    for (unsigned int j = 0; j < lookupsPerSample; ++j)
+                    {
+                        AdaptiveCardsBench::DoNotOptimize(map.find(probe));
+                    }
+                });
+            }
+        }
+    }
+
+    // string->enum conversion for known and unknown values. Unknown values are common in third-party cards; FromString
+    // signals them by throwing, TryFromString by returning std::nullopt.
+    void MeasureEnumConversion(AdaptiveCardsBench::BenchContext& context, const std::vector<std::string>& keys)
+    {
+        constexpr unsigned int conversionsPerSample = 100;
+        const std::vector<std::string> unknownValues{"ExtraExtraLarge", "Input.Signature", "wiggle", "Action.Custom", ""};
+
+        auto& fromStringHit = context.AddMeasurement("enum_lookup", "FromString.hit_x100");
+        auto& tryFromStringHit = context.AddMeasurement("enum_lookup", "TryFromString.hit_x100");
+        auto& fromStringMiss = context.AddMeasurement("enum_lookup", "FromString.miss_x100");
+        auto& tryFromStringMiss = context.AddMeasurement("enum_lookup", "TryFromString.miss_x100");
+
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            for (const auto& key : keys)
+            {
+                fromStringHit.Run(0, [&]() {
+                    for (unsigned int j = 0; j < conversionsPerSample; ++j)
+                    {
+                        AdaptiveCardsBench::DoNotOptimize(AdaptiveCardSchemaKeyFromString(key));
+                    }
+                });
+                tryFromStringHit.Run(0, [&]() {
+                    for (unsigned int j = 0; j < conversionsPerSample; ++j)
+                    {
+                        AdaptiveCardsBench::DoNotOptimize(AdaptiveCardSchemaKeyTryFromString(key));
+                    }
+                });
+            }
+
+            for (const auto& value : unknownValues)
+            {
+                fromStringMiss.Run(0, [&]() {
+                    for (unsigned int j = 0; j < conversionsPerSample; ++j)
+                    {
+                        try
+                        {
+                            AdaptiveCardsBench::DoNotOptimize(TextSizeFromString(value));
+                        }
+                        catch (const std::out_of_range&)
+                        {
+                        }
+                    }
+                });
+                tryFromStringMiss.Run(0, [&]() {
+                    for (unsigned int j = 0; j < conversionsPerSample; ++j)
+                    {
+                        AdaptiveCardsBench::DoNotOptimize(TextSizeTryFromString(value));
+                    }
+                });
+            }
+        }
+    }
+
+    // Bucket distribution and lookup cost of the case-insensitive string maps used for parser registrations, comparing
+    // the former additive hash with the current one, plus the cost of the enum string tables.
+    void RunEnumLookupBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto keys = GetSchemaKeyStrings();
+        MeasureHash<AdditiveCaseInsensitiveHash>(context, "additive_hash", keys);
+        MeasureHash<CaseInsensitiveHash>(context, "CaseInsensitiveHash", keys);
+        MeasureEnumConversion(context, keys);
+    }
+}
+
+REGISTER_BENCH_SUITE("enum_lookup", RunEnumLookupBench);
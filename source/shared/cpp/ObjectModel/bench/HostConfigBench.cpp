@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "HostConfig.h"
+#include "ParseUtil.h"
+
+#include <filesystem>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    std::vector<std::pair<std::string, HostConfig>> LoadHostConfigs(const std::string& samplesRoot)
+    {
+        std::vector<std::pair<std::string, HostConfig>> hostConfigs{{"default", HostConfig{}}};
+
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::path(samplesRoot) / "HostConfig", error))
+        {
+            if (entry.path().extension() != ".json")
+            {
+                continue;
+            }
+
+            std::ifstream stream{entry.path(), std::ios::binary};
+            std::ostringstream contents;
+            contents << stream.rdbuf();
+            try
+            {
+                hostConfigs.emplace_back(entry.path().filename().string(), HostConfig::DeserializeFromString(contents.str()));
+            }
+            catch (const std::exception&)
+            {
+                // not a host config the object model can read
+            }
+        }
+
+        std::sort(hostConfigs.begin(), hostConfigs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return hostConfigs;
+    }
+
+    // The lookups a renderer makes for one text element inside a container
+    struct TextElementStyle
+    {
+        ContainerStyle containerStyle;
+        ForegroundColor color;
+        bool isSubtle;
+        FontType fontType;
+        TextSize size;
+        TextWeight weight;
+    };
+
+    std::vector<TextElementStyle> MakeTextElements(unsigned int count)
+    {
+        std::vector<TextElementStyle> elements;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            elements.push_back({static_cast<ContainerStyle>(i % 7),
+                                static_cast<ForegroundColor>((i / 7) % 7),
+                                (i % 2) == 1,
+                                static_cast<FontType>((i / 3) % 2),
+                                static_cast<TextSize>(i % 5),
+                                static_cast<TextWeight>(i % 3)});
+        }
+        return elements;
+    }
+
+    // What renderers do today: fetch strings from HostConfig and parse the colors themselves
+    std::uint64_t StyleWithHostConfig(const HostConfig& hostConfig, const TextElementStyle& element)
+    {
+        std::uint64_t result = hostConfig.GetFontFamily(element.fontType).size();
+        result += hostConfig.GetFontSize(element.fontType, element.size);
+        result += hostConfig.GetFontWeight(element.fontType, element.weight);
+        result += ParseUtil::TryParseColor(hostConfig.GetForegroundColor(element.containerStyle, element.color, element.isSubtle)).value_or(0);
+        result += ParseUtil::TryParseColor(hostConfig.GetBackgroundColor(element.containerStyle)).value_or(0);
+        result += ParseUtil::TryParseColor(hostConfig.GetBorderColor(element.containerStyle)).value_or(0);
+        return result;
+    }
+
+    std::uint64_t StyleWithCompiled(const CompiledHostConfig& compiled, const TextElementStyle& element)
+    {
+        std::uint64_t result = compiled.GetFontFamily(element.fontType).size();
+        result += compiled.GetFontSize(element.fontType, element.size);
+        result += compiled.GetFontWeight(element.fontType, element.weight);
+        result += compiled.GetForegroundColor(element.containerStyle, element.color, element.isSubtle);
+        result += compiled.GetBackgroundColor(element.containerStyle);
+        result += compiled.GetBorderColor(element.containerStyle);
+        return result;
+    }
+
+    // Renderer-facing HostConfig getters for a render pass over many text elements, through HostConfig's string
+    // getters and through its CompiledHostConfig. Both must produce the same values for every sample host config.
+    void RunHostConfigBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto hostConfigs = LoadHostConfigs(context.GetSamplesRoot());
+        const auto elements = MakeTextElements(context.IsQuick() ? 100 : 1000);
+
+        for (const auto& hostConfig : hostConfigs)
+        {
+            for (const auto& element : elements)
+            {
+                if (StyleWithHostConfig(hostConfig.second, element) != StyleWithCompiled(hostConfig.second.GetCompiled(), element))
+                {
+                    throw std::runtime_error("host_config: compiled lookups differ from HostConfig for " + hostConfig.first);
+                }
+            }
+        }
+
+        auto& strings = context.AddMeasurement("host_config", "render_pass.HostConfig");
+        auto& compiled = context.AddMeasurement("host_config", "render_pass.CompiledHostConfig");
+        std::uint64_t checksum = 0;
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            for (const auto& hostConfig : hostConfigs)
+            {
+                strings.Run(0, [&]() {
+                    for (const auto& element : elements)
+                    {
+                        checksum += StyleWithHostConfig(hostConfig.second, element);
+                    }
+                });
+                compiled.Run(0, [&]() {
+                    const auto& compiledHostConfig = hostConfig.second.GetCompiled();
+                    for (const auto& element : elements)
+                    {
+                        checksum += StyleWithCompiled(compiledHostConfig, element);
+                    }
+                });
+            }
+        }
+        AdaptiveCardsBench::DoNotOptimize(checksum);
+
+        auto& deserialize = context.AddMeasurement("host_config", "DeserializeFromString");
+        const std::string json = R"({"fontFamily":"Segoe UI","containerStyles":{"default":{"backgroundColor":"#FFFFFF"}}})";
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            deserialize.Run(json.size(), [&]() { AdaptiveCardsBench::DoNotOptimize(HostConfig::DeserializeFromString(json)); });
+        }
+
+        context.AddMetric("host_config", "host_configs", static_cast<Json::UInt64>(hostConfigs.size()));
+        context.AddMetric("host_config", "elements_per_pass", static_cast<Json::UInt64>(elements.size()));
+    }
+}
+
+REGISTER_BENCH_SUITE("host_config", RunHostConfigBench);
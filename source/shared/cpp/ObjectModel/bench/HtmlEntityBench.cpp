@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "TextBlock.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // What TextElementProperties::SetText used to do, kept here as the "before" reference
+    std::string RegexProcessHtmlEntities(const std::string& input)
+    {
+        static const std::regex htmlEntities("&(amp|quot|lt|gt|nbsp);");
+        if (!std::regex_search(input, htmlEntities))
+        {
+            return input;
+        }
+
+        static const std::vector<std::pair<std::regex, std::string>> replacements = {{std::regex("&quot;"), "\""},
+                                                                                     {std::regex("&lt;"), "<"},
+                                                                                     {std::regex("&gt;"), ">"},
+                                                                                     {std::regex("&nbsp;"), " "},
+                                                                                     {std::regex("&amp;"), "&"}};
+        std::string output = input;
+        for (const auto& replacement : replacements)
+        {
+            output = std::regex_replace(output, replacement.first, replacement.second);
+        }
+        return output;
+    }
+
+    // Chat-digest style text of about `size` bytes, built from `fragments` in a fixed pseudo-random order
+    std::string MakeText(std::size_t size, const std::vector<std::string>& fragments)
+    {
+        std::string text;
+        unsigned int state = 12345;
+        while (text.size() < size)
+        {
+            state = state * 1103515245 + 12345;
+            text += fragments[(state >> 16) % fragments.size()];
+        }
+        return text;
+    }
+
+    void Verify(const std::string& text)
+    {
+        TextBlock textBlock;
+        textBlock.SetText(text);
+        if (textBlock.GetText() != RegexProcessHtmlEntities(text))
+        {
+            throw std::runtime_error("html_entities: decoded text differs from the regex implementation");
+        }
+    }
+
+    void MeasureText(AdaptiveCardsBench::BenchContext& context, const std::string& name, const std::string& text)
+    {
+        Verify(text);
+
+        auto& regex = context.AddMeasurement("html_entities", name + ".regex");
+        auto& singlePass = context.AddMeasurement("html_entities", name + ".SetText");
+        TextBlock textBlock;
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            regex.Run(text.size(), [&]() { AdaptiveCardsBench::DoNotOptimize(RegexProcessHtmlEntities(text)); });
+            singlePass.Run(text.size(), [&]() { textBlock.SetText(text); });
+        }
+    }
+
+    // Decoding supported HTML entities in large TextBlock texts: the regex search plus five regex_replace passes it
+    // used to take against the single-pass decoder, on text with escapes, text without any '&', and the edge cases.
+    void RunHtmlEntityBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const std::vector<std::string> edgeCases{"", "&", "&&", "&amp;", "&amp;amp;", "&amp;nbsp;", "&&lt;lt;", "&lt",
+                                                 "&lt ;", "&LT;", "&foo;", "&am p;", "&quot;&quot;", "a&nbsp;b&gt;", ";&;",
+                                                 "&amp&lt;;", "trailing &"};
+        for (const auto& edgeCase : edgeCases)
+        {
+            Verify(edgeCase);
+        }
+
+        const std::size_t size = context.IsQuick() ? 4 * 1024 : 64 * 1024;
+        MeasureText(context,
+                    "escaped_" + std::to_string(size / 1024) + "KB",
+                    MakeText(size,
+                             {"Alice: ", "Bob: ", "&quot;sounds good&quot; ", "R&amp;D ", "&lt;b&gt;", "x &lt; y ",
+                              "&nbsp;", "see you at 5 ", "Q&amp;A tomorrow. ", "&amp;nbsp; ", "& then ", "ok\n"}));
+        MeasureText(context,
+                    "plain_" + std::to_string(size / 1024) + "KB",
+                    MakeText(size, {"Alice: ", "Bob: ", "sounds good ", "see you at 5 ", "ok\n", "lunch? "}));
+    }
+}
+
+REGISTER_BENCH_SUITE("html_entities", RunHtmlEntityBench);
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+#include <cmath>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // What ParseUtil::JsonToString used to do, kept here as the "before" reference and as the oracle for the output
+    std::string StreamWriterToString(const Json::Value& json)
+    {
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+        std::ostringstream outStream;
+        writer->write(json, &outStream);
+        outStream << std::endl;
+        return outStream.str();
+    }
+
+    // Values the corpus doesn't exercise: escapes, malformed UTF-8, embedded NULs, extreme numbers, empty containers
+    Json::Value MakeEdgeCases()
+    {
+        Json::Value json(Json::objectValue);
+        json["strings"].append("");
+        json["strings"].append("plain");
+        json["strings"].append("quote \" backslash \\ slash / controls \b\f\n\r\t \x01 \x1f \x7f");
+        json["strings"].append("caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80 \xed\xa0\x80 \xc0\xaf \x80 \xff \xe2\x82");
+        json["strings"].append(Json::Value(std::string("embedded\0nul", 12)));
+        json["strings"].append(Json::Value(Json::stringValue));
+        json["numbers"].append(0);
+        json["numbers"].append(-1);
+        json["numbers"].append(Json::Value::minLargestInt);
+        json["numbers"].append(Json::Value::maxLargestUInt);
+        json["numbers"].append(0.0);
+        json["numbers"].append(-0.0);
+        json["numbers"].append(1.5);
+        json["numbers"].append(0.1);
+        json["numbers"].append(1e300);
+        json["numbers"].append(-2.5e-300);
+        json["numbers"].append(123456789012.0);
+        json["numbers"].append(std::nan(""));
+        json["numbers"].append(HUGE_VAL);
+        json["numbers"].append(-HUGE_VAL);
+        json["nested"]["empty_array"] = Json::Value(Json::arrayValue);
+        json["nested"]["empty_object"] = Json::Value(Json::objectValue);
+        json["nested"]["null"] = Json::Value();
+        json["nested"]["bools"].append(true);
+        json["nested"]["bools"].append(false);
+        json[std::string("key\nwith\0nul", 12)] = "value";
+        for (int i = 0; i < 40; ++i)
+        {
+            json["long_array"].append(i);
+        }
+        return json;
+    }
+
+    void Verify(const Json::Value& json, const std::string& name)
+    {
+        if (ParseUtil::JsonToString(json) != StreamWriterToString(json))
+        {
+            throw std::runtime_error("json_writer: output for " + name + " differs from Json::StreamWriter");
+        }
+    }
+
+    // Turning an already built Json::Value into a string with Json::StreamWriter and an ostringstream (the old
+    // ParseUtil::JsonToString) against the direct writer, with and without reusing the output buffer, plus building
+    // the Json::Value and AdaptiveCard::Serialize end to end. Both writers must produce the same bytes.
+    void RunJsonWriterBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        Verify(MakeEdgeCases(), "edge cases");
+
+        std::vector<std::shared_ptr<AdaptiveCard>> cards;
+        std::vector<Json::Value> documents;
+        std::size_t totalBytes = 0;
+        for (const auto& entry : context.GetCorpus())
+        {
+            try
+            {
+                Verify(ParseUtil::GetJsonValueFromString(entry.json), entry.path);
+                cards.push_back(AdaptiveCard::DeserializeFromString(entry.json, c_sharedModelVersion)->GetAdaptiveCard());
+                documents.push_back(cards.back()->SerializeToJsonValue());
+                Verify(documents.back(), entry.path + " (serialized)");
+                totalBytes += ParseUtil::JsonToString(documents.back()).size();
+            }
+            catch (const AdaptiveCardParseException&)
+            {
+                // not a card this version can parse
+            }
+        }
+
+        auto& streamWriter = context.AddMeasurement("json_writer", "corpus.StreamWriter");
+        auto& direct = context.AddMeasurement("json_writer", "corpus.JsonToString");
+        auto& reused = context.AddMeasurement("json_writer", "corpus.JsonToString_reused_buffer");
+        auto& buildValue = context.AddMeasurement("json_writer", "corpus.SerializeToJsonValue");
+        auto& serialize = context.AddMeasurement("json_writer", "corpus.AdaptiveCard_Serialize");
+        std::string buffer;
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            streamWriter.Run(totalBytes, [&]() {
+                for (const auto& document : documents)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(StreamWriterToString(document));
+                }
+            });
+            direct.Run(totalBytes, [&]() {
+                for (const auto& document : documents)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(ParseUtil::JsonToString(document));
+                }
+            });
+            reused.Run(totalBytes, [&]() {
+                for (const auto& document : documents)
+                {
+                    ParseUtil::JsonToString(document, buffer);
+                    AdaptiveCardsBench::DoNotOptimize(buffer);
+                }
+            });
+            buildValue.Run(totalBytes, [&]() {
+                for (const auto& card : cards)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(card->SerializeToJsonValue());
+                }
+            });
+            serialize.Run(totalBytes, [&]() {
+                for (const auto& card : cards)
+                {
+                    AdaptiveCardsBench::DoNotOptimize(card->Serialize());
+                }
+            });
+        }
+        context.AddMetric("json_writer", "cards", static_cast<Json::UInt64>(cards.size()));
+    }
+}
+
+REGISTER_BENCH_SUITE("json_writer", RunJsonWriterBench);
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "MarkDownCorpus.h"
+#include "MarkDownParser.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // What MarkDownParser::TransformToHtml used to do, kept here as the "before" reference and as the oracle for the
+    // output
+    std::string StreamTransformToHtml(const std::string& text, bool& hasHtmlTags)
+    {
+        hasHtmlTags = false;
+        if (text.empty())
+        {
+            return "<p></p>";
+        }
+
+        std::string escaped;
+        for (const char ch : text)
+        {
+            switch (ch)
+            {
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            case '&':
+                escaped += "&amp;";
+                break;
+            default:
+                escaped += ch;
+                break;
+            }
+        }
+
+        std::stringstream stream(escaped);
+        EmphasisParser parser;
+        while (!stream.eof())
+        {
+            parser.ParseBlock(stream);
+        }
+
+        MarkDownParsedResult parsedResult;
+        parsedResult.AppendParseResult(parser.GetParsedResult());
+        parsedResult.Translate();
+        parsedResult.AddBlockTags();
+        hasHtmlTags = parsedResult.HasHtmlTags();
+        return parsedResult.GenerateHtmlString();
+    }
+
+    void Verify(const std::vector<std::string>& texts, const std::string& name)
+    {
+        for (const auto& text : texts)
+        {
+            bool hasHtmlTags = false;
+            const std::string expected = StreamTransformToHtml(text, hasHtmlTags);
+            MarkDownParser parser(text);
+            if (parser.TransformToHtml() != expected || parser.HasHtmlTags() != hasHtmlTags)
+            {
+                throw std::runtime_error("markdown: html for " + name + " differs from the stream parsers: " + text);
+            }
+        }
+    }
+
+    void MeasureTexts(AdaptiveCardsBench::BenchContext& context, const std::string& name, const std::vector<std::string>& texts)
+    {
+        Verify(texts, name);
+
+        std::size_t bytes = 0;
+        for (const auto& text : texts)
+        {
+            bytes += text.size();
+        }
+
+        auto& stream = context.AddMeasurement("markdown", name + ".stream_parsers");
+        auto& tokenizer = context.AddMeasurement("markdown", name + ".TransformToHtml");
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            stream.Run(bytes, [&]() {
+                for (const auto& text : texts)
+                {
+                    bool hasHtmlTags = false;
+                    AdaptiveCardsBench::DoNotOptimize(StreamTransformToHtml(text, hasHtmlTags));
+                }
+            });
+            tokenizer.Run(bytes, [&]() {
+                for (const auto& text : texts)
+                {
+                    MarkDownParser parser(text);
+                    AdaptiveCardsBench::DoNotOptimize(parser.TransformToHtml());
+                }
+            });
+        }
+
+        for (const auto* measurement : {&stream, &tokenizer})
+        {
+            const double p50 = measurement->GetPercentile(50);
+            context.AddMetric("markdown", measurement->GetName() + ".p50_mb_per_second",
+                              p50 > 0.0 ? bytes / p50 * 1e9 / (1024.0 * 1024.0) : 0.0);
+        }
+    }
+
+    // MarkDownParser::TransformToHtml with the stringstream based EmphasisParser/LinkParser/ListParser and
+    // MarkDownParsedResult it used to run on, against the tokenizer that replaced them, on the markdown unit test
+    // texts, the TextBlock and TextRun texts of the sample cards, and a long chat message. The html and HasHtmlTags
+    // must be the same for every text.
+    void RunMarkDownBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        MeasureTexts(context, "unit_tests", AdaptiveCardsBench::GetMarkDownTestCorpus());
+
+        MeasureTexts(context, "card_texts", AdaptiveCardsBench::GetMarkDownCardTexts(context.GetCorpus()));
+
+        const std::size_t size = context.IsQuick() ? 4 * 1024 : 64 * 1024;
+        MeasureTexts(context, "chat_" + std::to_string(size / 1024) + "KB", {AdaptiveCardsBench::MakeMarkDownChatText(size)});
+    }
+}
+
+REGISTER_BENCH_SUITE("markdown", RunMarkDownBench);
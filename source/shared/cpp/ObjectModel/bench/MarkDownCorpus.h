@@ -0,0 +1,231 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+
+namespace AdaptiveCardsBench
+{
+    // The texts MarkDownUnitTest.cpp parses, each once
+    inline const std::vector<std::string>& GetMarkDownTestCorpus()
+    {
+        static const std::vector<std::string> corpus{
+            "",
+            "*",
+            "**",
+            "*foo bar*",
+            "_foo bar_",
+            "_ foo bar_",
+            "a*\"foo\"*",
+            "a_\"foo\"_",
+            "foo*bar*",
+            "foo_bar_",
+            "5*6*78",
+            "5_6_78",
+            "foo-_(bar)_",
+            "_foo_",
+            "_foo*",
+            "*foo *",
+            "*(*foo*)*",
+            "*(foo)*",
+            "*foo*bar",
+            "_foo bar _",
+            "_foo_bar",
+            "_(bar)_.",
+            "**foo bar**",
+            "__foo bar__",
+            "** foo bar**",
+            "__ foo bar__",
+            "**foo bar **",
+            "__foo bar __",
+            "a**\"foo bar\"**",
+            "a__\"foo bar\"__",
+            "**foo**bar",
+            "__foo__bar",
+            "**(**foo)",
+            "__(__foo",
+            "foo-__(bar)__",
+            "(**foo**)",
+            "(__foo__)",
+            "__(foo)__.",
+            "_foo __bar__ baz_",
+            "*foo *bar**",
+            "_foo _bar_ baz_",
+            "*foo **bar** baz*",
+            "*foo **bar *baz* bim** bop*",
+            "***foo** bar*",
+            "*foo **bar***",
+            "** is not an empty emphasis",
+            "**** is not an empty emphasis",
+            "**foo\nbar**",
+            "__foo __bar__ baz__",
+            "**foo **bar****",
+            "**foo *bar **baz**\n bim* bop**",
+            "foo *\\**",
+            "foo **\\***",
+            "foo __\\___",
+            "**foo*",
+            "*foo**",
+            "***foo**",
+            "*foo****",
+            "**Gomphocarpus (*Gomphocarpus physocarpus*, syn.\n*Asclepias physocarpa*)**",
+            "*Hello* abc ***Hello* def *world***",
+            "*foo**bar**baz*",
+            "****foo****",
+            "******foo******",
+            "***foo***",
+            "_____foo_____",
+            "*foo _bar* baz_",
+            "*foo __bar *baz bim__ bam*",
+            "**foo **bar baz**",
+            "*foo *bar baz*",
+            "**K *J *foo**bar* *cool*",
+            "**m *J *foo**bar *cool**",
+            "**H *foo**bar***",
+            "*hello *hi **H foo** bar**",
+            "hello **how are** *you **i** am **great** *thank* **you***",
+            "hello, **how are__ you**",
+            "hello, __how **are__ you?**",
+            "*hello *hello**h*",
+            "[hello](www.naver.com)",
+            "[[[[hello](www.naver.com)",
+            "[[hello]](www.naver.com)",
+            "[*[hello]*](www.naver.com)",
+            "[*[hello[hello]hello]*](www.naver.com)",
+            "[*hello[hello]hello](www.naver.com)",
+            "[*hellohello]hello](www.naver.com)",
+            "[Bug [021356]](https://msn.com): Markdown link parsing",
+            "[hello(www.naver.com)",
+            "*[*hello(www.naver.com)",
+            "*[*hello(www.naver.com)*",
+            "[a[b[hello](www.naver.com)",
+            "[[a[b[h(ello](www.naver.com)",
+            "[[cool link!]](https://contoso.com/New%20Document%20(1\\).docx)",
+            "[1234.5](www.naver.com)",
+            "[hello]a(www.naver.com)",
+            "*[hello](www.naver.com)*",
+            "[*hello*](www.naver.com)",
+            "*[*hello*](www.naver.com)",
+            "*[*hello*](*www.naver.com*)",
+            "**Hello** *[*hello*](*www.naver.com*)*",
+            "*Hello* *[*hello*](*www.naver.com*)** Hello, [second](www.microsoft.com)",
+            "- hello",
+            "* hello",
+            "+ hello",
+            "- hello\n- world\n- hi",
+            "* hello\n* world\n* hi",
+            "* hello\n- Hi",
+            "+ hello\n+ world\n+ hi",
+            "- hello world - hello hello",
+            "* hello world - hello hello",
+            "- hello world + hello hello",
+            "- hello world - hello hello\r- winner winner chicken dinner",
+            "* hello world * hello hello\r* winner winner chicken dinner",
+            "+ hello world * hello hello\r+ winner winner chicken dinner",
+            "- hello world - hello hello\r- ***winner* winner** chicken dinner",
+            "* hello world * hello hello\r* ***winner* winner** chicken dinner",
+            "+ hello world * hello hello\r+ ***winner* winner** chicken dinner",
+            "- hello world\r- hello hello\r- new site = [adaptive card](www.adaptivecards.io)",
+            "* hello world\r* hello hello\r* new site = [adaptive card](www.adaptivecards.io)",
+            "+ hello world\r+ hello hello\r+ new site = [adaptive card](www.adaptivecards.io)",
+            "Hello\r- my list",
+            "Hello\r* my list",
+            "Hello\r+ my list",
+            "- my list\r\rHello",
+            "* my list\r\rHello",
+            "+ my list\r\rHello",
+            "- my list\rHello",
+            "* my list\rHello",
+            "+ my list\rHello",
+            "023-34-567",
+            "* foo bar*",
+            "1. hello",
+            "1. hello\n2. Hi",
+            "1. hello world - hello hello",
+            "1. hello world - hello hello\r2. winner winner chicken dinner",
+            "1. hello world - hello hello\r- ***winner* winner** chicken dinner",
+            "1. hello world\r2. hello hello\r3. new site = [adaptive card](www.adaptivecards.io)",
+            "Hello\r1. my list",
+            "1. my list\r\rHello",
+            "1. my list\rHello",
+            "777. my list\rHello",
+            "5>3",
+            "3<5",
+            "\"Hello World!\"",
+            "Green Eggs & Ham",
+            "\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2",
+            "**\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2**",
+            "How about **\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2**",
+            "\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2 **\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2**",
+            "\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2**\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2**",
+            "How about**\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2**",
+            "It's OK!\rClick [\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2](https://www.microsoft.com)\rClick [\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2](https://www.microsoft.com)",
+            "1. Click [\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2](https://www.microsoft.com)\r2. Click [\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2](https://www.microsoft.com)",
+            "It's not OK!\r1. Click [\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2](https://www.microsoft.com)\r2. Click [\xe4\xbb\xa5\xe5\x89\x8d\xe3\x81\xae\xe8\xa3\xbd\xe5\x93\x81\xe3\x81\xae\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x81\xa7\xe6\xa4\x9c\xe7\xb4\xa2](https://www.microsoft.com)",
+            "&",
+            "Hello World&",
+            " & ",
+        };
+        return corpus;
+    }
+
+    inline void CollectMarkDownTexts(const Json::Value& json, std::vector<std::string>& texts)
+    {
+        if (json.isObject())
+        {
+            const Json::Value& type = json["type"];
+            const Json::Value& text = json["text"];
+            if (type.isString() && (type.asString() == "TextBlock" || type.asString() == "TextRun") && text.isString())
+            {
+                texts.push_back(text.asString());
+            }
+        }
+
+        if (json.isObject() || json.isArray())
+        {
+            for (const auto& child : json)
+            {
+                CollectMarkDownTexts(child, texts);
+            }
+        }
+    }
+
+    // The text of every TextBlock and TextRun in the corpus cards
+    inline std::vector<std::string> GetMarkDownCardTexts(const std::vector<CorpusEntry>& corpus)
+    {
+        std::vector<std::string> texts;
+        for (const auto& entry : corpus)
+        {
+            try
+            {
+                CollectMarkDownTexts(AdaptiveCards::ParseUtil::GetJsonValueFromString(entry.json), texts);
+            }
+            catch (const AdaptiveCards::AdaptiveCardParseException&)
+            {
+                // not valid json
+            }
+        }
+        return texts;
+    }
+
+    // Chat style markdown of about `size` bytes, built from fragments in a fixed pseudo-random order. Every fragment
+    // ends in a space, as the stringstream based parsers the markdown suite compares against never finish on a word
+    // directly followed by "***" (e.g. "item***really***")
+    inline std::string MakeMarkDownChatText(std::size_t size)
+    {
+        static const char* const fragments[] = {"Alice: ", "Bob: ", "sounds **good** ", "see _you_ at 5 ",
+                                                "check [the docs](https://adaptivecards.io/explorer) ", "x < y & z ",
+                                                "***really*** ", "\r- first item ", "\r- second item ", "\r1. step one ",
+                                                "\r2. step two ", "\n\nok ", "snake_case_name ", "2 * 3 = 6 ", "\\*not bold\\* "};
+        std::string text;
+        unsigned int state = 12345;
+        while (text.size() < size)
+        {
+            state = state * 1103515245 + 12345;
+            text += fragments[(state >> 16) % std::size(fragments)];
+        }
+        return text;
+    }
+}
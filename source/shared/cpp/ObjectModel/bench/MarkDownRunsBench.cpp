@@ -0,0 +1,259 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "MarkDownCorpus.h"
+#include "MarkDownParser.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // A MarkDownRun with its text and link copied out, which is what a host ends up with either way
+    struct StyledText
+    {
+        std::string text;
+        MarkDownBlockType blockType;
+        bool isBlockStart;
+        bool isBold;
+        bool isItalic;
+        bool isLink;
+        std::string link;
+        std::string listStart;
+
+        bool HasStyleOf(const StyledText& other) const
+        {
+            return blockType == other.blockType && isBold == other.isBold && isItalic == other.isItalic &&
+                isLink == other.isLink && link == other.link && listStart == other.listStart;
+        }
+
+        bool operator==(const StyledText& other) const
+        {
+            return text == other.text && isBlockStart == other.isBlockStart && HasStyleOf(other);
+        }
+    };
+
+    // Appends, or extends the last styled text if it has the same style, so that both sides split text the same way
+    void AddStyledText(std::vector<StyledText>& styledTexts, StyledText styledText)
+    {
+        if (!styledText.isBlockStart && !styledTexts.empty() && styledTexts.back().HasStyleOf(styledText))
+        {
+            styledTexts.back().text += styledText.text;
+        }
+        else if (styledText.isBlockStart || !styledText.text.empty())
+        {
+            styledTexts.push_back(std::move(styledText));
+        }
+    }
+
+    std::string DecodeEntities(std::string_view html)
+    {
+        static const std::pair<std::string_view, char> entities[] = {{"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&amp;", '&'}};
+        std::string text;
+        for (std::size_t i = 0; i < html.size(); ++i)
+        {
+            bool isEntity = false;
+            if (html[i] == '&')
+            {
+                for (const auto& entity : entities)
+                {
+                    if (html.compare(i, entity.first.size(), entity.first) == 0)
+                    {
+                        text += entity.second;
+                        i += entity.first.size() - 1;
+                        isEntity = true;
+                        break;
+                    }
+                }
+            }
+            if (!isEntity)
+            {
+                text += html[i];
+            }
+        }
+        return text;
+    }
+
+    // What a host has to do with TransformToHtml's output to get the styled text out of it: scan the tags and decode
+    // the entities. It only knows the tags TransformToHtml writes, so it's cheaper than a real html import.
+    std::vector<StyledText> ParseHtml(const std::string& html)
+    {
+        std::vector<StyledText> styledTexts;
+        StyledText current{{}, MarkDownBlockType::Paragraph, false, false, false, false, {}, {}};
+        std::vector<MarkDownBlockType> lists;
+        std::vector<std::string> links;
+        int boldTags = 0;
+        int italicTags = 0;
+        int listItemDepth = 0;
+
+        // a block without any text is an empty text without style
+        const auto endBlock = [&]() {
+            if (current.isBlockStart)
+            {
+                AddStyledText(styledTexts,
+                              {{}, current.blockType, true, false, false, false, {},
+                               (current.blockType == MarkDownBlockType::NumberedListItem) ? current.listStart : std::string()});
+            }
+        };
+        const auto startBlock = [&](MarkDownBlockType blockType) {
+            endBlock();
+            current.blockType = blockType;
+            current.isBlockStart = true;
+        };
+
+        std::size_t i = 0;
+        while (i < html.size())
+        {
+            if (html[i] == '<')
+            {
+                const std::size_t end = html.find('>', i);
+                const std::string_view tag(html.data() + i + 1, end - i - 1);
+                if (tag == "p")
+                {
+                    if (!listItemDepth)
+                    {
+                        startBlock(MarkDownBlockType::Paragraph);
+                    }
+                }
+                else if (tag == "ul")
+                {
+                    lists.push_back(MarkDownBlockType::BulletedListItem);
+                }
+                else if (tag.substr(0, 9) == "ol start=")
+                {
+                    lists.push_back(MarkDownBlockType::NumberedListItem);
+                    current.listStart = std::string(tag.substr(10, tag.size() - 11));
+                }
+                else if (tag == "/ul" || tag == "/ol")
+                {
+                    lists.pop_back();
+                }
+                else if (tag == "li")
+                {
+                    ++listItemDepth;
+                    startBlock(lists.back());
+                }
+                else if (tag == "/li")
+                {
+                    --listItemDepth;
+                }
+                else if (tag == "em" || tag == "/em")
+                {
+                    italicTags += (tag == "em") ? 1 : -1;
+                }
+                else if (tag == "strong" || tag == "/strong")
+                {
+                    boldTags += (tag == "strong") ? 1 : -1;
+                }
+                else if (tag.substr(0, 7) == "a href=")
+                {
+                    links.push_back(DecodeEntities(tag.substr(8, tag.size() - 9)));
+                }
+                else if (tag == "/a")
+                {
+                    links.pop_back();
+                }
+                i = end + 1;
+            }
+            else
+            {
+                const std::size_t end = std::min(html.find('<', i), html.size());
+                current.text = DecodeEntities(std::string_view(html.data() + i, end - i));
+                current.isBold = boldTags > 0;
+                current.isItalic = italicTags > 0;
+                current.isLink = !links.empty();
+                current.link = links.empty() ? std::string() : links.back();
+                const bool isNumbered = current.blockType == MarkDownBlockType::NumberedListItem;
+                StyledText styledText = current;
+                if (!isNumbered)
+                {
+                    styledText.listStart.clear();
+                }
+                AddStyledText(styledTexts, std::move(styledText));
+                if (!current.text.empty())
+                {
+                    current.isBlockStart = false;
+                }
+                current.text.clear();
+                i = end;
+            }
+        }
+
+        endBlock();
+        return styledTexts;
+    }
+
+    std::vector<StyledText> ToStyledTexts(const std::string& text, const std::vector<MarkDownRun>& runs)
+    {
+        std::vector<StyledText> styledTexts;
+        for (const auto& run : runs)
+        {
+            AddStyledText(styledTexts,
+                          {text.substr(run.textOffset, run.textLength), run.blockType, run.isBlockStart, run.isBold, run.isItalic,
+                           run.isLink, run.link, text.substr(run.listStartOffset, run.listStartLength)});
+        }
+        return styledTexts;
+    }
+
+    void Verify(const std::vector<std::string>& texts, const std::string& name)
+    {
+        for (const auto& text : texts)
+        {
+            MarkDownParser htmlParser(text);
+            const auto expected = ParseHtml(htmlParser.TransformToHtml());
+            MarkDownParser runsParser(text);
+            if (ToStyledTexts(text, runsParser.TransformToRuns()) != expected || runsParser.HasHtmlTags() != htmlParser.HasHtmlTags())
+            {
+                throw std::runtime_error("markdown_runs: runs for " + name + " differ from the html: " + text);
+            }
+        }
+    }
+
+    void MeasureTexts(AdaptiveCardsBench::BenchContext& context, const std::string& name, const std::vector<std::string>& texts)
+    {
+        Verify(texts, name);
+
+        std::size_t bytes = 0;
+        for (const auto& text : texts)
+        {
+            bytes += text.size();
+        }
+
+        auto& html = context.AddMeasurement("markdown_runs", name + ".TransformToHtml+parse");
+        auto& runs = context.AddMeasurement("markdown_runs", name + ".TransformToRuns");
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            html.Run(bytes, [&]() {
+                for (const auto& text : texts)
+                {
+                    MarkDownParser parser(text);
+                    AdaptiveCardsBench::DoNotOptimize(ParseHtml(parser.TransformToHtml()));
+                }
+            });
+            runs.Run(bytes, [&]() {
+                for (const auto& text : texts)
+                {
+                    MarkDownParser parser(text);
+                    AdaptiveCardsBench::DoNotOptimize(parser.TransformToRuns());
+                }
+            });
+        }
+
+        for (const auto* measurement : {&html, &runs})
+        {
+            const double p50 = measurement->GetPercentile(50);
+            context.AddMetric("markdown_runs", measurement->GetName() + ".p50_mb_per_second",
+                              p50 > 0.0 ? bytes / p50 * 1e9 / (1024.0 * 1024.0) : 0.0);
+        }
+    }
+
+    // Getting styled text out of markdown: TransformToHtml followed by the scan of its html a host does, against
+    // TransformToRuns, on the markdown unit test texts and the TextBlock and TextRun texts of the sample cards. Both
+    // must give the same text and styles.
+    void RunMarkDownRunsBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        MeasureTexts(context, "unit_tests", AdaptiveCardsBench::GetMarkDownTestCorpus());
+        MeasureTexts(context, "card_texts", AdaptiveCardsBench::GetMarkDownCardTexts(context.GetCorpus()));
+    }
+}
+
+REGISTER_BENCH_SUITE("markdown_runs", RunMarkDownRunsBench);
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "MarkDownCorpus.h"
+#include "MarkDownParser.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    constexpr std::size_t c_chunkSize = 10;
+
+    // The html after every chunk must be what TransformToHtml gives for the text so far, and the start of it reported
+    // unchanged must be the same as the html before
+    void Verify(const std::string& message)
+    {
+        IncrementalMarkDownParser incremental;
+        std::string previousHtml = incremental.GetHtml();
+        for (std::size_t offset = 0; offset < message.size(); offset += c_chunkSize)
+        {
+            const std::size_t unchangedSize = incremental.AppendText(message.substr(offset, c_chunkSize));
+            const std::string text = message.substr(0, offset + c_chunkSize);
+            MarkDownParser parser(text);
+            if (incremental.GetHtml() != parser.TransformToHtml() || incremental.HasHtmlTags() != parser.HasHtmlTags())
+            {
+                throw std::runtime_error("markdown_stream: html differs from TransformToHtml after " + std::to_string(text.size()) + " bytes");
+            }
+            if (unchangedSize > previousHtml.size() || incremental.GetHtml().compare(0, unchangedSize, previousHtml, 0, unchangedSize) != 0)
+            {
+                throw std::runtime_error("markdown_stream: html reported unchanged has changed after " + std::to_string(text.size()) + " bytes");
+            }
+            previousHtml = incremental.GetHtml();
+        }
+    }
+
+    // Plain text of the given size, with the separator between sentences
+    std::string MakePlainText(std::size_t size, const std::string& separator)
+    {
+        std::string text;
+        while (text.size() < size)
+        {
+            text += "The quick brown fox jumps over the lazy dog." + separator;
+        }
+        return text;
+    }
+
+    void AddMegabytesPerSecond(AdaptiveCardsBench::BenchContext& context, const AdaptiveCardsBench::Measurement& measurement, std::size_t size)
+    {
+        const double p50 = measurement.GetPercentile(50);
+        context.AddMetric("markdown_stream", measurement.GetName() + ".p50_mb_per_second",
+                          p50 > 0.0 ? size / p50 * 1e9 / (1024.0 * 1024.0) : 0.0);
+    }
+
+    // AppendText over the message a chunk at a time, and how much html that writes per chunk
+    void MeasureIncremental(AdaptiveCardsBench::BenchContext& context, AdaptiveCardsBench::Measurement& measurement, const std::string& message)
+    {
+        std::size_t htmlSize = 0;
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            measurement.Run(message.size(), [&]() {
+                htmlSize = 0;
+                IncrementalMarkDownParser parser;
+                for (std::size_t offset = 0; offset < message.size(); offset += c_chunkSize)
+                {
+                    const std::size_t unchangedSize = parser.AppendText(message.substr(offset, c_chunkSize));
+                    htmlSize += parser.GetHtml().size() - unchangedSize;
+                }
+                AdaptiveCardsBench::DoNotOptimize(parser.GetHtml());
+            });
+        }
+
+        const std::size_t chunks = (message.size() + c_chunkSize - 1) / c_chunkSize;
+        AddMegabytesPerSecond(context, measurement, message.size());
+        context.AddMetric("markdown_stream", measurement.GetName() + ".html_bytes_per_chunk", static_cast<double>(htmlSize) / chunks);
+    }
+
+    // A bot streaming a long message into a TextBlock a few bytes at a time, with the html brought up to date after
+    // each chunk: TransformToHtml on all the text received so far, which makes the stream quadratic, against
+    // IncrementalMarkDownParser::AppendText. Also reports how much html each of them writes per chunk. Two worst cases
+    // for AppendText are streamed through it too: a '[' that no ']' follows, which MatchLink reads on to the end of the
+    // text from, and one long paragraph, which is a single text token.
+    void RunMarkDownStreamBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const std::size_t size = context.IsQuick() ? 8 * 1024 : 50 * 1024;
+        const std::string message = AdaptiveCardsBench::MakeMarkDownChatText(size);
+        const std::string sizeName = std::to_string(size / 1024) + "KB";
+        const std::string name = "chat_" + sizeName;
+        const std::string unclosedLink = "a[i\r\r" + MakePlainText(size, "\n\n");
+        const std::string paragraph = MakePlainText(size, " ");
+        Verify(message);
+        Verify(unclosedLink);
+        Verify(paragraph);
+
+        std::size_t reparseHtmlSize = 0;
+        auto& reparse = context.AddMeasurement("markdown_stream", name + ".TransformToHtml");
+        auto& incremental = context.AddMeasurement("markdown_stream", name + ".IncrementalMarkDownParser");
+
+        // every pass of TransformToHtml parses the message over size / c_chunkSize / 2 times
+        const unsigned int reparsePasses = context.IsQuick() ? 1 : std::max(1U, context.GetIterations() / 4);
+        for (unsigned int i = 0; i < reparsePasses; ++i)
+        {
+            reparse.Run(message.size(), [&]() {
+                reparseHtmlSize = 0;
+                std::string text;
+                for (std::size_t offset = 0; offset < message.size(); offset += c_chunkSize)
+                {
+                    text.append(message, offset, c_chunkSize);
+                    MarkDownParser parser(text);
+                    const std::string html = parser.TransformToHtml();
+                    reparseHtmlSize += html.size();
+                    AdaptiveCardsBench::DoNotOptimize(html);
+                }
+            });
+        }
+        MeasureIncremental(context, incremental, message);
+
+        auto& unclosedLinkIncremental = context.AddMeasurement("markdown_stream", "unclosed_link_" + sizeName + ".IncrementalMarkDownParser");
+        MeasureIncremental(context, unclosedLinkIncremental, unclosedLink);
+        auto& paragraphIncremental = context.AddMeasurement("markdown_stream", "paragraph_" + sizeName + ".IncrementalMarkDownParser");
+        MeasureIncremental(context, paragraphIncremental, paragraph);
+
+        AddMegabytesPerSecond(context, reparse, message.size());
+        const std::size_t chunks = (message.size() + c_chunkSize - 1) / c_chunkSize;
+        context.AddMetric("markdown_stream", reparse.GetName() + ".html_bytes_per_chunk", static_cast<double>(reparseHtmlSize) / chunks);
+    }
+}
+
+REGISTER_BENCH_SUITE("markdown_stream", RunMarkDownStreamBench);
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // A card of `depth` nested ColumnSets. Each level holds a column with some text and a column holding the next
+    // level; the innermost one holds an ImageSet. Columns and images leave their (implied) type out.
+    std::string MakeNestedCard(unsigned int depth)
+    {
+        std::string level = R"({"type":"ImageSet","images":[{"url":"https://adaptivecards.io/a.png"},{"url":"https://adaptivecards.io/b.png"}]})";
+        for (unsigned int i = 0; i < depth; ++i)
+        {
+            level = R"({"type":"ColumnSet","columns":[{"width":"auto","items":[{"type":"TextBlock","text":"Level )" +
+                    std::to_string(depth - i) + R"(","wrap":true}]},{"width":"stretch","items":[)" + level + "]}]}";
+        }
+        return R"({"type":"AdaptiveCard","version":"1.5","body":[)" + level + "]}";
+    }
+
+    // Deserialization of increasingly deep cards from an already parsed Json::Value. Every level adds the same amount
+    // of content, so time and allocated bytes per level should stay flat as the depth grows.
+    void RunNestedCollectionBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const unsigned int maxDepth = context.IsQuick() ? 10 : 20;
+        for (unsigned int depth = 5; depth <= maxDepth; depth += 5)
+        {
+            const std::string card = MakeNestedCard(depth);
+            const Json::Value json = ParseUtil::GetJsonValueFromString(card);
+
+            auto& deserialize = context.AddMeasurement("nested_collection", "depth_" + std::to_string(depth) + ".Deserialize");
+            for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+            {
+                ParseContext parseContext;
+                deserialize.Run(card.size(), [&]() {
+                    AdaptiveCardsBench::DoNotOptimize(AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext));
+                });
+            }
+
+            ParseContext parseContext;
+            const auto before = AdaptiveCardsBench::AllocationSnapshot::Take();
+            AdaptiveCardsBench::DoNotOptimize(AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext));
+            const auto after = AdaptiveCardsBench::AllocationSnapshot::Take();
+
+            Json::Value perLevel;
+            perLevel["allocated_bytes_per_level"] = static_cast<Json::UInt64>((after.bytes - before.bytes) / depth);
+            perLevel["allocations_per_level"] = static_cast<Json::UInt64>((after.allocations - before.allocations) / depth);
+            perLevel["p50_ns_per_level"] = deserialize.GetPercentile(50) / depth;
+            context.AddMetric("nested_collection", "depth_" + std::to_string(depth), perLevel);
+        }
+    }
+}
+
+REGISTER_BENCH_SUITE("nested_collection", RunNestedCollectionBench);
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+
+#include <cstring>
+#include <iostream>
+
+#ifndef OBJECTMODELBENCH_SAMPLES_DIR
+#define OBJECTMODELBENCH_SAMPLES_DIR "samples"
+#endif
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::cerr << "usage: " << program << " [options]\n"
+                  << "  --samples <dir>      root of the samples corpus (default: " OBJECTMODELBENCH_SAMPLES_DIR ")\n"
+                  << "  --iterations <n>     repetitions per input (default: 20)\n"
+                  << "  --suite <name>       only run suites whose name contains <name> (repeatable)\n"
+                  << "  --json <file>        write machine-readable results to <file> ('-' for stdout)\n"
+                  << "  --quick              single iteration, reduced synthetic inputs (used by ctest)\n"
+                  << "  --list               list registered suites and exit\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::string samplesRoot{OBJECTMODELBENCH_SAMPLES_DIR};
+    std::string jsonPath;
+    std::vector<std::string> suiteFilters;
+    unsigned int iterations = 20;
+    bool quick = false;
+
+    auto& suites = AdaptiveCardsBench::GetRegisteredSuites();
+    std::sort(suites.begin(), suites.end(), [](const auto& a, const auto& b) { return std::strcmp(a.name, b.name) < 0; });
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument{argv[i]};
+        const bool hasValue = (i + 1) < argc;
+        if (argument == "--samples" && hasValue)
+        {
+            samplesRoot = argv[++i];
+        }
+        else if (argument == "--iterations" && hasValue)
+        {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (argument == "--suite" && hasValue)
+        {
+            suiteFilters.emplace_back(argv[++i]);
+        }
+        else if (argument == "--json" && hasValue)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (argument == "--quick")
+        {
+            quick = true;
+            iterations = 1;
+        }
+        else if (argument == "--list")
+        {
+            for (const auto& suite : suites)
+            {
+                std::cout << suite.name << "\n";
+            }
+            return 0;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    auto corpus = AdaptiveCardsBench::LoadCorpus(samplesRoot);
+    if (corpus.empty())
+    {
+        std::cerr << "No sample cards found under '" << samplesRoot << "'\n";
+        return 1;
+    }
+
+    AdaptiveCardsBench::BenchContext context{std::move(corpus), samplesRoot, iterations, quick};
+    for (const auto& suite : suites)
+    {
+        const bool selected = suiteFilters.empty() ||
+                              std::any_of(suiteFilters.begin(), suiteFilters.end(), [&suite](const std::string& filter) {
+                                  return std::string{suite.name}.find(filter) != std::string::npos;
+                              });
+        if (selected)
+        {
+            std::cerr << "running " << suite.name << "...\n";
+            suite.run(context);
+        }
+    }
+
+    const std::string report = context.ToJson().toStyledString();
+    if (jsonPath == "-")
+    {
+        std::cout << report;
+    }
+    else
+    {
+        context.PrintSummary(std::cout);
+        if (!jsonPath.empty())
+        {
+            std::ofstream{jsonPath} << report;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // samples/v1.5/Scenarios holds a single card in this tree, so the suite runs over the Scenarios folders of every
+    // schema version. These are realistic, property-dense cards.
+    std::vector<AdaptiveCardsBench::CorpusEntry> GetScenarioCards(const AdaptiveCardsBench::BenchContext& context)
+    {
+        std::vector<AdaptiveCardsBench::CorpusEntry> scenarios;
+        for (auto& entry : context.GetCorpusSubset("/Scenarios/"))
+        {
+            if (entry.path.rfind("v1.", 0) == 0)
+            {
+                scenarios.push_back(std::move(entry));
+            }
+        }
+        return scenarios;
+    }
+
+    void CollectObjects(const Json::Value& json, std::vector<const Json::Value*>& objects)
+    {
+        if (json.isObject())
+        {
+            objects.push_back(&json);
+        }
+
+        if (json.isObject() || json.isArray())
+        {
+            for (const auto& child : json)
+            {
+                CollectObjects(child, objects);
+            }
+        }
+    }
+
+    std::vector<AdaptiveCardSchemaKey> GetSchemaKeys()
+    {
+        std::vector<AdaptiveCardSchemaKey> keys;
+        for (int i = 0; i <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); ++i)
+        {
+            const auto key = static_cast<AdaptiveCardSchemaKey>(i);
+            if (!AdaptiveCardSchemaKeyToStringView(key).empty())
+            {
+                keys.push_back(key);
+            }
+        }
+        return keys;
+    }
+
+    // Probes every schema key on every JSON object of each card: the way the ParseUtil getters used to look a
+    // property up (key name from the enum map, then Json::Value::get with a default, copying the result) against the
+    // interned key table and Json::Value::find.
+    void MeasurePropertyLookup(AdaptiveCardsBench::BenchContext& context,
+                               const std::vector<AdaptiveCardsBench::CorpusEntry>& cards,
+                               const std::vector<AdaptiveCardSchemaKey>& keys)
+    {
+        auto& copyingLookup = context.AddMeasurement("property_lookup", "lookup.get_copy");
+        auto& findLookup = context.AddMeasurement("property_lookup", "lookup.FindProperty");
+
+        std::uint64_t objectCount = 0;
+        for (const auto& card : cards)
+        {
+            const Json::Value json = ParseUtil::GetJsonValueFromString(card.json);
+            std::vector<const Json::Value*> objects;
+            CollectObjects(json, objects);
+            objectCount += objects.size();
+
+            for (unsigned int i = 0; i < context.GetIterations(); ++i)
+            {
+                copyingLookup.Run(0, [&]() {
+                    for (const auto* object : objects)
+                    {
+                        for (const auto key : keys)
+                        {
+                            const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+                            auto propertyValue = object->get(propertyName, Json::Value());
+                            AdaptiveCardsBench::DoNotOptimize(propertyValue);
+                        }
+                    }
+                });
+
+                findLookup.Run(0, [&]() {
+                    for (const auto* object : objects)
+                    {
+                        for (const auto key : keys)
+                        {
+                            AdaptiveCardsBench::DoNotOptimize(ParseUtil::FindProperty(*object, key));
+                        }
+                    }
+                });
+            }
+        }
+
+        Json::Value lookupsPerCard;
+        lookupsPerCard["objects"] = static_cast<Json::UInt64>(objectCount);
+        lookupsPerCard["keys"] = static_cast<Json::UInt64>(keys.size());
+        lookupsPerCard["cards"] = static_cast<Json::UInt64>(cards.size());
+        context.AddMetric("property_lookup", "probes", lookupsPerCard);
+    }
+
+    // Object model construction from an already parsed Json::Value, which is the part of deserialization dominated
+    // by ParseUtil property getters.
+    void MeasureDeserialize(AdaptiveCardsBench::BenchContext& context, const std::vector<AdaptiveCardsBench::CorpusEntry>& cards)
+    {
+        auto& deserialize = context.AddMeasurement("property_lookup", "Deserialize");
+
+        for (const auto& card : cards)
+        {
+            const Json::Value json = ParseUtil::GetJsonValueFromString(card.json);
+            for (unsigned int i = 0; i < context.GetIterations(); ++i)
+            {
+                try
+                {
+                    ParseContext parseContext;
+                    deserialize.Run(card.json.size(), [&]() {
+                        AdaptiveCardsBench::DoNotOptimize(AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext));
+                    });
+                }
+                catch (const std::exception&)
+                {
+                    deserialize.RecordFailure();
+                    break;
+                }
+            }
+        }
+    }
+
+    void RunPropertyLookupBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const auto cards = GetScenarioCards(context);
+        MeasurePropertyLookup(context, cards, GetSchemaKeys());
+        MeasureDeserialize(context, cards);
+    }
+}
+
+REGISTER_BENCH_SUITE("property_lookup", RunPropertyLookupBench);
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "Container.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // `count` text blocks in containers of ten, every element requiring the Adaptive Cards version and a host feature
+    std::string MakeRequiresCard(unsigned int count)
+    {
+        std::ostringstream card;
+        card << R"({"type":"AdaptiveCard","version":"1.5","body":[)";
+        for (unsigned int i = 0; i < count; i += 10)
+        {
+            card << (i ? "," : "") << R"({"type":"Container","requires":{"adaptiveCards":"1.2"},"items":[)";
+            for (unsigned int j = i; j < std::min(count, i + 10); ++j)
+            {
+                card << (j > i ? "," : "") << R"({"type":"TextBlock","text":"Item )" << j
+                     << R"(","requires":{"adaptiveCards":"1.3","acme.charts":"2.1.)" << (j % 3) << R"("}})";
+            }
+            card << "]}";
+        }
+        card << "]}";
+        return card.str();
+    }
+
+    void CollectElements(const std::vector<std::shared_ptr<BaseCardElement>>& elements, std::vector<const BaseElement*>& collected)
+    {
+        for (const auto& element : elements)
+        {
+            collected.push_back(element.get());
+            if (const auto container = std::dynamic_pointer_cast<Container>(element))
+            {
+                CollectElements(container->GetItems(), collected);
+            }
+        }
+    }
+
+    // Parsing a card where every element carries `requires`, and checking all of those requirements against a host
+    // feature registration the way renderers do for each element they render.
+    void RunRequirementsBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const unsigned int count = context.IsQuick() ? 100 : 1000;
+        const std::string card = MakeRequiresCard(count);
+        const Json::Value json = ParseUtil::GetJsonValueFromString(card);
+
+        auto& deserialize = context.AddMeasurement("requirements", "elements_" + std::to_string(count) + ".Deserialize");
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            ParseContext parseContext;
+            deserialize.Run(card.size(), [&]() {
+                AdaptiveCardsBench::DoNotOptimize(AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext));
+            });
+        }
+
+        ParseContext parseContext;
+        const auto parseResult = AdaptiveCard::Deserialize(json, c_sharedModelVersion, parseContext);
+        std::vector<const BaseElement*> elements;
+        CollectElements(parseResult->GetAdaptiveCard()->GetBody(), elements);
+
+        FeatureRegistration featureRegistration;
+        featureRegistration.AddFeature("acme.charts", "2.1.1");
+        featureRegistration.AddFeature("acme.maps", "*");
+
+        unsigned int metCount = 0;
+        auto& meetsRequirements = context.AddMeasurement("requirements", "elements_" + std::to_string(count) + ".MeetsRequirements");
+        for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+        {
+            meetsRequirements.Run(0, [&]() {
+                metCount = 0;
+                for (const auto element : elements)
+                {
+                    metCount += element->MeetsRequirements(featureRegistration) ? 1 : 0;
+                }
+            });
+        }
+
+        // Host-side version queries, spelled in a different case than the features were registered with
+        const std::vector<std::string> featureNames{"AdaptiveCards", "ACME.Charts", "acme.MAPS", "acme.missing"};
+        std::size_t versionLength = 0;
+        auto& getFeatureVersion = context.AddMeasurement("requirements", "GetFeatureVersion");
+        for (unsigned int i = 0; i < 10 * context.GetIterations(); ++i)
+        {
+            getFeatureVersion.Run(0, [&]() {
+                for (unsigned int j = 0; j < 250; ++j)
+                {
+                    for (const auto& featureName : featureNames)
+                    {
+                        versionLength += featureRegistration.GetFeatureVersion(featureName).length();
+                    }
+                }
+            });
+        }
+        AdaptiveCardsBench::DoNotOptimize(versionLength);
+
+        // text blocks asking for acme.charts 2.1.2 aren't met, everything else is
+        const unsigned int expectedMet = count - count / 3;
+        if (metCount != elements.size() - count + expectedMet)
+        {
+            throw std::runtime_error("requirements: " + std::to_string(metCount) + " of " + std::to_string(elements.size()) +
+                                     " elements met their requirements");
+        }
+        context.AddMetric("requirements", "elements_met", metCount);
+    }
+}
+
+REGISTER_BENCH_SUITE("requirements", RunRequirementsBench);
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "BenchHarness.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+    // Runs `call` `count` times and records its time and the heap allocations it makes per call
+    template<typename Call>
+    void MeasureCalls(AdaptiveCardsBench::BenchContext& context, const std::string& name, std::size_t bytes, unsigned int count, Call call)
+    {
+        auto& measurement = context.AddMeasurement("string_parse", name);
+        for (unsigned int i = 0; i < context.GetIterations(); ++i)
+        {
+            measurement.Run(bytes * count, [&]() {
+                for (unsigned int j = 0; j < count; ++j)
+                {
+                    call();
+                }
+            });
+        }
+
+        // warm, so that only steady-state allocations are counted
+        call();
+        const auto before = AdaptiveCardsBench::AllocationSnapshot::Take();
+        for (unsigned int j = 0; j < count; ++j)
+        {
+            call();
+        }
+        const auto after = AdaptiveCardsBench::AllocationSnapshot::Take();
+
+        Json::Value perCall;
+        perCall["allocations_per_call"] = static_cast<double>(after.allocations - before.allocations) / count;
+        perCall["allocated_bytes_per_call"] = static_cast<double>(after.bytes - before.bytes) / count;
+        context.AddMetric("string_parse", name, perCall);
+    }
+
+    // The string entry points (DeserializeFromString and JsonToString) called over and over on small inputs, where
+    // setting up the JSON reader or writer is a large part of each call.
+    void RunStringParseBench(AdaptiveCardsBench::BenchContext& context)
+    {
+        const unsigned int count = context.IsQuick() ? 200 : 2000;
+        const auto elementParser = std::make_shared<TextBlockParser>();
+        ParseContext parseContext;
+
+        const std::string textBlock = R"({"type":"TextBlock","text":"Hello \"world\"","wrap":true,"size":"large"})";
+        MeasureCalls(context, "TextBlock.DeserializeFromString", textBlock.size(), count, [&]() {
+            AdaptiveCardsBench::DoNotOptimize(elementParser->DeserializeFromString(parseContext, textBlock));
+        });
+
+        // comments aren't strict JSON, but jsoncpp's reader accepts them
+        const std::string lenient = R"({"type":"TextBlock", /* lenient */ "text":"Hello"})";
+        MeasureCalls(context, "lenient.GetJsonValueFromString", lenient.size(), count, [&]() {
+            AdaptiveCardsBench::DoNotOptimize(ParseUtil::GetJsonValueFromString(lenient));
+        });
+
+        const std::string card =
+            R"({"type":"AdaptiveCard","version":"1.5","body":[{"type":"TextBlock","text":"Hi"}],"actions":[{"type":"Action.Submit","title":"OK"}]})";
+        MeasureCalls(context, "card.DeserializeFromString", card.size(), count, [&]() {
+            AdaptiveCardsBench::DoNotOptimize(AdaptiveCard::DeserializeFromString(card, c_sharedModelVersion));
+        });
+
+        const auto cardJson = ParseUtil::GetJsonValueFromString(card);
+        MeasureCalls(context, "card.JsonToString", card.size(), count, [&]() {
+            AdaptiveCardsBench::DoNotOptimize(ParseUtil::JsonToString(cardJson));
+        });
+    }
+}
+
+REGISTER_BENCH_SUITE("string_parse", RunStringParseBench);
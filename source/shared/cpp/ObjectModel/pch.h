@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <limits>
 #include <locale>
 #include <memory>
 #include <numeric>